@@ -0,0 +1,127 @@
+/**
+ * @brief Sembol Tablosu Mikro Kıyaslaması
+ * 10^3 - 10^6 etiketle symtable_add / symtable_lookup sürelerini ölçer. Özet tablosunda işlem
+ * başına süre etiket sayısından bağımsız kalmalıdır (O(1)). Karşılaştırma için eski tablonun
+ * doğrusal strcmp taraması da küçük boyutlarda ölçülür (O(n), büyük boyutlarda dakikalar sürer).
+ *
+ * Derleme (depo kökünden):
+ *   gcc -O2 -Isrc -o symtable_bench bench/symtable_bench.c src/smybol_table.c src/interner.c \
+ *       src/arena.c src/utils.c src/error.c -lpthread
+ * Çalıştırma:
+ *   ./symtable_bench [en_büyük_etiket_sayısı]   (varsayılan: 1000000)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "symbol_table.h"
+#include "interner.h"
+#include "utils.h" // safe_malloc için
+
+#define LINEAR_MAX_LABELS 10000 // Doğrusal taramanın ölçüldüğü en büyük boyut
+#define NAME_LENGTH 16
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Aramaların önbellekte sıralı gitmemesi için sırayı karıştır (sabit tohumlu xorshift)
+static void shuffle(SymbolId *ids, size_t count) {
+    uint32_t state = 2463534242u;
+    for (size_t i = count; i > 1; i--) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        size_t j = state % i;
+        SymbolId tmp = ids[i - 1];
+        ids[i - 1] = ids[j];
+        ids[j] = tmp;
+    }
+}
+
+/**
+ * @brief Eski SymbolTable'ın arama yöntemi: Etiket adları üzerinde doğrusal strcmp taraması.
+ */
+static double linear_lookup_ns(char (*names)[NAME_LENGTH], size_t count, const SymbolId *order) {
+    size_t found = 0;
+    double start = now_ns();
+    for (size_t i = 0; i < count; i++) {
+        const char *wanted = names[order[i]];
+        for (size_t k = 0; k < count; k++) {
+            if (strcmp(names[k], wanted) == 0) {
+                found++;
+                break;
+            }
+        }
+    }
+    double elapsed = now_ns() - start;
+    if (found != count) fprintf(stderr, "UYARI: Doğrusal taramada %zu etiket bulunamadı.\n", count - found);
+    return elapsed / (double)count;
+}
+
+static void run(size_t count) {
+    Interner interner;
+    interner_init(&interner);
+    char (*names)[NAME_LENGTH] = safe_malloc(count * sizeof(*names));
+    SymbolId *ids = (SymbolId *)safe_malloc(count * sizeof(SymbolId));
+    for (size_t i = 0; i < count; i++) {
+        int length = snprintf(names[i], NAME_LENGTH, "L%zu", i);
+        ids[i] = interner_intern(&interner, names[i], (size_t)length);
+    }
+
+    SymbolTable *table = symtable_init();
+    double start = now_ns();
+    for (size_t i = 0; i < count; i++) {
+        symtable_add(table, ids[i], SYM_TYPE_LABEL, (long long)i);
+    }
+    double add_ns = (now_ns() - start) / (double)count;
+
+    SymbolId *order = (SymbolId *)safe_malloc(count * sizeof(SymbolId));
+    memcpy(order, ids, count * sizeof(SymbolId));
+    shuffle(order, count);
+
+    size_t found = 0;
+    start = now_ns();
+    for (size_t i = 0; i < count; i++) {
+        found += symtable_lookup(table, order[i]) != NULL;
+    }
+    double hit_ns = (now_ns() - start) / (double)count;
+
+    // Tabloda olmayan kimlikler (örn. tanımlanmamış etikete atlama denetimi)
+    SymbolId missing = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (ids[i] >= missing) missing = ids[i] + 1;
+    }
+    start = now_ns();
+    for (size_t i = 0; i < count; i++) {
+        found += symtable_lookup(table, (SymbolId)(missing + i)) != NULL;
+    }
+    double miss_ns = (now_ns() - start) / (double)count;
+    if (found != count) fprintf(stderr, "UYARI: %zu arama beklenmeyen sonuç verdi.\n", found > count ? found - count : count - found);
+
+    printf("%9zu etiket | ekleme %7.1f ns | bulunan %7.1f ns | bulunmayan %7.1f ns", count, add_ns, hit_ns, miss_ns);
+    if (count <= LINEAR_MAX_LABELS) {
+        // Doğrusal tarama için karıştırılmış sıra, 0..count-1 indeksleri üzerinden tekrarlanır
+        for (size_t i = 0; i < count; i++) order[i] = (SymbolId)i;
+        shuffle(order, count);
+        printf(" | doğrusal (eski) %10.1f ns", linear_lookup_ns(names, count, order));
+    }
+    printf("\n");
+
+    symtable_free(table);
+    interner_free(&interner);
+    free(order);
+    free(ids);
+    free(names);
+}
+
+int main(int argc, char *argv[]) {
+    size_t max_count = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    printf("Sembol Tablosu Kıyaslaması (işlem başına ortalama süre)\n");
+    for (size_t count = 1000; count <= max_count; count *= 10) {
+        run(count);
+    }
+    return 0;
+}
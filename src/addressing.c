@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "addressing.h"
+#include "isel.h"  // isel_constant_sequence için
+#include "utils.h" // safe_malloc için
+
+// LW/SW ofset alanı: [-2048, 2047], bir pencere 4 KiB kapsar
+#define ADDRESS_OFFSET_MIN  (-2048)
+#define ADDRESS_OFFSET_MAX  2047
+#define ADDRESS_WINDOW_SPAN 4096
+
+// Döngü derinliği ağırlığı için üst sınır (regalloc.c ile aynı)
+#define ADDRESS_MAX_WEIGHT_DEPTH 6
+
+// Programdaki tek bir erişim adresi ve ağırlığı
+typedef struct {
+    uint32_t address;
+    double weight;
+} AddressAccess;
+
+// --- Yardımcı İşlevler ---
+
+static double depth_weight(int depth) {
+    double weight = 1.0;
+    if (depth > ADDRESS_MAX_WEIGHT_DEPTH) depth = ADDRESS_MAX_WEIGHT_DEPTH;
+    for (int d = 0; d < depth; d++) weight *= 10.0;
+    return weight;
+}
+
+static int compare_access_address(const void *a, const void *b) {
+    uint32_t x = ((const AddressAccess *)a)->address;
+    uint32_t y = ((const AddressAccess *)b)->address;
+    return x < y ? -1 : (x > y);
+}
+
+/**
+ * @brief Komut başına döngü derinliğini hesaplar: Her geri atlama [hedef, atlama] aralığını kapsar.
+ * @return int*: Komut başına derinlik (çağıran serbest bırakır).
+ */
+static int *statement_loop_depths(const AST_Program *program) {
+    AST_StmtIndex count = program->statement_count;
+    uint32_t label_count = interner_count(&program->names) + 1;
+
+    AST_StmtIndex *label_index = (AST_StmtIndex *)safe_malloc(label_count * sizeof(AST_StmtIndex));
+    for (uint32_t l = 0; l < label_count; l++) label_index[l] = UINT32_MAX;
+    for (AST_StmtIndex i = 0; i < count; i++) {
+        if (ast_stmt_type(program, i) == STMT_TYPE_LABEL_DEF) label_index[ast_stmt_label(program, i)] = i;
+    }
+
+    int *depth = (int *)safe_malloc(((size_t)count + 1) * sizeof(int));
+    memset(depth, 0, ((size_t)count + 1) * sizeof(int));
+    for (AST_StmtIndex j = 0; j < count; j++) {
+        StatementType type = ast_stmt_type(program, j);
+        if (type != STMT_TYPE_GOTO && type != STMT_TYPE_IF_GOTO) continue;
+        AST_StmtIndex target = label_index[ast_stmt_label(program, j)];
+        if (target <= j) {
+            depth[target]++;
+            depth[j + 1]--;
+        }
+    }
+    for (AST_StmtIndex i = 1; i <= count; i++) depth[i] += depth[i - 1];
+
+    free(label_index);
+    return depth;
+}
+
+/**
+ * @brief Komuttaki MEM[] operantlarını erişim listesine ekler.
+ */
+static void collect_accesses(const AST_Program *program, AST_StmtIndex index, double weight,
+                             AddressAccess **accesses, size_t *count, size_t *capacity) {
+    int first_slot = AST_SLOT_DEST, last_slot = AST_SLOT_RIGHT;
+    switch (ast_stmt_type(program, index)) {
+        case STMT_TYPE_ASSIGNMENT:
+            if (program->ops[index] == AST_OP_NONE) last_slot = AST_SLOT_LEFT;
+            break;
+        case STMT_TYPE_IF_GOTO:
+            first_slot = AST_SLOT_LEFT;
+            break;
+        default:
+            return;
+    }
+
+    for (int slot = first_slot; slot <= last_slot; slot++) {
+        AST_Operand operand = ast_stmt_operand(program, index, slot);
+        if (operand.type != OPR_TYPE_MEMORY_ADDR) continue;
+        if (*count == *capacity) {
+            *capacity *= 2;
+            *accesses = (AddressAccess *)safe_realloc(*accesses, *capacity * sizeof(AddressAccess));
+        }
+        (*accesses)[(*count)++] = (AddressAccess){(uint32_t)operand.mem_address, weight};
+    }
+}
+
+/**
+ * @brief [first, last] adreslerini kapsayan pencerenin taban değerini seçer.
+ * Mümkünse 4 KiB'ın katı seçilir; böylece taban tek bir LUI ile yüklenir.
+ */
+static uint32_t choose_window_base(uint32_t first, uint32_t last) {
+    uint64_t low = (uint64_t)last - ADDRESS_OFFSET_MAX;   // Tabanın alabileceği en küçük değer
+    uint64_t high = (uint64_t)first - ADDRESS_OFFSET_MIN; // Tabanın alabileceği en büyük değer
+    uint64_t aligned = (low + ADDRESS_WINDOW_SPAN - 1) / ADDRESS_WINDOW_SPAN * ADDRESS_WINDOW_SPAN;
+    return (uint32_t)(aligned <= high ? aligned : high);
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+void address_plan_build(AddressPlan *plan, const AST_Program *program, Register *next_register) {
+    plan->windows = NULL;
+    plan->window_count = 0;
+    plan->spill_base = 0;
+
+    // 1. Erişimleri döngü ağırlıklarıyla topla, adrese göre sırala ve birleştir
+    int *depth = statement_loop_depths(program);
+    size_t count = 0, capacity = 64;
+    AddressAccess *accesses = (AddressAccess *)safe_malloc(capacity * sizeof(AddressAccess));
+    for (AST_StmtIndex i = 0; i < program->statement_count; i++) {
+        collect_accesses(program, i, depth_weight(depth[i]), &accesses, &count, &capacity);
+    }
+    free(depth);
+
+    if (count == 0) {
+        free(accesses);
+        return;
+    }
+    qsort(accesses, count, sizeof(AddressAccess), compare_access_address);
+    plan->spill_base = ((uint64_t)accesses[count - 1].address + 4 + 3) & ~(uint64_t)3;
+
+    // 2. Açgözlü kapsama: Sıradaki kapsanmamış adres yeni bir pencere başlatır ve pencere
+    // 4 KiB içindeki tüm adresleri alır (noktaları aralıklarla kapsamada en az pencereyi verir).
+    plan->windows = (AddressWindow *)safe_malloc(count * sizeof(AddressWindow));
+    size_t k = 0;
+    while (k < count) {
+        AddressWindow window = {accesses[k].address, 0, R_ZERO, 0.0};
+        uint32_t last = window.start;
+        bool zero_page = window.start <= ADDRESS_OFFSET_MAX;
+
+        while (k < count) {
+            uint32_t address = accesses[k].address;
+            if (zero_page ? address > ADDRESS_OFFSET_MAX : address - window.start >= ADDRESS_WINDOW_SPAN) break;
+            last = address;
+            window.weight += accesses[k].weight;
+            k++;
+        }
+        if (!zero_page) window.base = choose_window_base(window.start, last);
+        plan->windows[plan->window_count++] = window;
+    }
+    free(accesses);
+
+    // 3. En ağır pencere gp'yi, diğerleri sabit taban sanal kayıtlarını alır
+    AddressWindow *heaviest = NULL;
+    for (size_t w = 0; w < plan->window_count; w++) {
+        AddressWindow *window = &plan->windows[w];
+        if (window->start <= ADDRESS_OFFSET_MAX) continue; // x0 penceresi
+        if (heaviest == NULL || window->weight > heaviest->weight) heaviest = window;
+    }
+    size_t base_registers = 0;
+    for (size_t w = 0; w < plan->window_count; w++) {
+        AddressWindow *window = &plan->windows[w];
+        if (window->start <= ADDRESS_OFFSET_MAX) continue;
+        if (window == heaviest) {
+            window->reg = R_GP;
+        } else {
+            window->reg = (*next_register)++;
+            base_registers++;
+        }
+    }
+
+    if (heaviest != NULL) {
+        printf("Bellek Adresleme: %zu pencere (gp = 0x%X, %zu ek taban kaydı).\n",
+               plan->window_count, heaviest->base, base_registers);
+    }
+}
+
+void address_plan_emit_bases(const AddressPlan *plan, CodeBuffer *buffer) {
+    for (size_t w = 0; w < plan->window_count; w++) {
+        const AddressWindow *window = &plan->windows[w];
+        if (window->reg == R_ZERO) continue;
+        Instruction sequence[2];
+        int length = isel_constant_sequence((int32_t)window->base, window->reg, sequence);
+        for (int i = 0; i < length; i++) code_buffer_append(buffer, sequence[i]);
+    }
+}
+
+void address_plan_resolve(const AddressPlan *plan, long long address, Register *base, int32_t *offset) {
+    uint32_t target = (uint32_t)address;
+
+    // Başlangıcı hedefi geçmeyen son pencere (ikili arama)
+    size_t low = 0, high = plan->window_count;
+    while (high - low > 1) {
+        size_t mid = low + (high - low) / 2;
+        if (plan->windows[mid].start <= target) low = mid; else high = mid;
+    }
+
+    const AddressWindow *window = &plan->windows[low];
+    *base = window->reg;
+    *offset = (int32_t)(target - window->base);
+}
+
+void address_plan_free(AddressPlan *plan) {
+    free(plan->windows);
+    plan->windows = NULL;
+    plan->window_count = 0;
+    plan->spill_base = 0;
+}
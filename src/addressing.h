@@ -0,0 +1,57 @@
+#ifndef BESSAMBLY_ADDRESSING_H
+#define BESSAMBLY_ADDRESSING_H
+
+#include <stdint.h>
+#include "ast.h"
+#include "ir_generator.h" // CodeBuffer ve Register için
+
+/**
+ * @brief Bellek Adresleme Planı
+ * MEM[adres] erişimleri sabit adreslidir. LW/SW'nin ofseti 12-bit işaretli olduğundan
+ * her erişim, adresi [taban - 2048, taban + 2047] penceresine düşen bir taban kaydı
+ * üzerinden tek talimatla yapılır:
+ *   - İlk 2 KiB (0..2047) x0 ile adreslenir.
+ *   - Döngü ağırlıklı erişim sayısı en yüksek pencere gp (global pointer) kaydını alır.
+ *   - Diğer pencereler sabit taban sanal kayıtlarını alır; kayıt atayıcı baskı altında
+ *     bunları belleğe taşımak yerine yeniden üretir.
+ * Tüm taban kayıtları program girişinde bir kez yüklenir (döngülerin dışına çıkarılmış olur).
+ *
+ * Kayıt atayıcının taşıdığı kayıtlar, programın eriştiği en yüksek adresten sonraki ilk
+ * kelimede başlayan taşma alanında tutulur; böylece programın kendi MEM[] verisiyle çakışmaz.
+ */
+
+// Tek bir taban kaydının kapsadığı 4 KiB'lık adres penceresi
+typedef struct {
+    uint32_t start;  // Penceredeki ilk erişilen adres
+    uint32_t base;   // Taban kaydının değeri (erişim ofseti: adres - base)
+    Register reg;    // R_ZERO, R_GP veya sabit taban sanal kaydı
+    double weight;   // Döngü derinliği ağırlıklı erişim sayısı
+} AddressWindow;
+
+typedef struct {
+    AddressWindow *windows; // Başlangıç adresine göre sıralı, örtüşmeyen pencereler
+    size_t window_count;
+    uint64_t spill_base;    // Taşma alanının başlangıcı (erişim yoksa 0; 2^32 olabilir)
+} AddressPlan;
+
+/**
+ * @brief Programdaki tüm MEM[] erişimlerini en az sayıda pencereyle kapsayan planı oluşturur.
+ * @param next_register: Sıradaki boş sanal kayıt; taban kayıtları için ilerletilir.
+ */
+void address_plan_build(AddressPlan *plan, const AST_Program *program, Register *next_register);
+
+/**
+ * @brief Taban kayıtlarını yükleyen talimatları (LUI/ADDI) arabelleğe üretir.
+ * Program girişinde, ilk komuttan önce çağrılmalıdır.
+ */
+void address_plan_emit_bases(const AddressPlan *plan, CodeBuffer *buffer);
+
+/**
+ * @brief Bir adresin taban kaydını ve 12-bit ofsetini döndürür.
+ * Adres plan oluşturulurken programda görülmüş olmalıdır.
+ */
+void address_plan_resolve(const AddressPlan *plan, long long address, Register *base, int32_t *offset);
+
+void address_plan_free(AddressPlan *plan);
+
+#endif // BESSAMBLY_ADDRESSING_H
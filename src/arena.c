@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdalign.h> // alignof için
+#include "arena.h"
+#include "utils.h" // safe_malloc için
+
+#define ARENA_INITIAL_BLOCK_SIZE (64 * 1024)        // İlk blok boyutu
+#define ARENA_MAX_BLOCK_SIZE     (16 * 1024 * 1024) // Blok büyümesinin üst sınırı
+#define ARENA_ALIGNMENT          alignof(max_align_t)
+
+// Arena bloğu: başlık + kullanılabilir alan
+struct ArenaBlock {
+    ArenaBlock *next; // Bir önceki (daha eski) blok
+    size_t capacity;  // data alanının boyutu
+    size_t used;      // data alanının kullanılan kısmı
+    alignas(max_align_t) unsigned char data[];
+};
+
+// --- Yardımcı İşlevler ---
+
+static size_t arena_align_up(size_t value) {
+    return (value + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+/**
+ * @brief En az min_size bayt alabilen yeni bir blok ekler.
+ */
+static void arena_grow(Arena *arena, size_t min_size) {
+    size_t capacity = arena->next_block_size;
+    if (capacity < min_size) {
+        capacity = arena_align_up(min_size);
+    }
+
+    ArenaBlock *block = (ArenaBlock *)safe_malloc(sizeof(ArenaBlock) + capacity);
+    block->next = arena->head;
+    block->capacity = capacity;
+    block->used = 0;
+    arena->head = block;
+    arena->reserved_bytes += sizeof(ArenaBlock) + capacity;
+
+    if (arena->next_block_size < ARENA_MAX_BLOCK_SIZE) {
+        arena->next_block_size *= 2;
+    }
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+void arena_init(Arena *arena) {
+    arena->head = NULL;
+    arena->next_block_size = ARENA_INITIAL_BLOCK_SIZE;
+    arena->reserved_bytes = 0;
+    arena->used_bytes = 0;
+}
+
+void *arena_alloc(Arena *arena, size_t size) {
+    size = arena_align_up(size == 0 ? 1 : size);
+
+    ArenaBlock *block = arena->head;
+    if (block == NULL || block->capacity - block->used < size) {
+        arena_grow(arena, size);
+        block = arena->head;
+    }
+
+    void *ptr = block->data + block->used;
+    block->used += size;
+    arena->used_bytes += size;
+    return ptr;
+}
+
+char *arena_strndup(Arena *arena, const char *text, size_t length) {
+    char *copy = (char *)arena_alloc(arena, length + 1);
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+void arena_release(Arena *arena) {
+    ArenaBlock *block = arena->head;
+    while (block != NULL) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena_init(arena);
+}
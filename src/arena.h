@@ -0,0 +1,44 @@
+#ifndef BESSAMBLY_ARENA_H
+#define BESSAMBLY_ARENA_H
+
+#include <stddef.h> // size_t için
+
+// Bölge (Arena) Bellek Tahsis Edici
+// Bellek büyük bloklar halinde alınır ve içinden sırayla (bump) dağıtılır.
+// Tek tek serbest bırakma yoktur; tüm arena tek bir arena_release çağrısıyla bırakılır.
+
+typedef struct ArenaBlock ArenaBlock;
+
+typedef struct {
+    ArenaBlock *head;       // En son tahsis edilen blok (tahsisler buradan yapılır)
+    size_t next_block_size; // Bir sonraki bloğun boyutu (her blokta iki katına çıkar)
+    size_t reserved_bytes;  // Sistemden alınan toplam bayt (blok başlıkları dahil)
+    size_t used_bytes;      // Kullanıcıya verilen toplam bayt (hizalama dolgusu dahil)
+} Arena;
+
+/**
+ * @brief Boş bir arenayı başlatır. İlk blok ilk tahsiste alınır.
+ * @param arena: Başlatılacak arena.
+ */
+void arena_init(Arena *arena);
+
+/**
+ * @brief Arenadan hizalanmış bellek tahsis eder. Başarısız olursa hata raporlar ve çıkar.
+ * @param arena: Tahsisin yapılacağı arena.
+ * @param size: Tahsis edilecek bayt sayısı.
+ * @return void*: Tahsis edilen bellek (arena bırakılana kadar geçerlidir).
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief Verilen metni (NULL ile sonlandırılmış olması gerekmez) arenaya kopyalar ve sonlandırır.
+ * @return char*: Arenadaki NULL ile sonlandırılmış kopya.
+ */
+char *arena_strndup(Arena *arena, const char *text, size_t length);
+
+/**
+ * @brief Arenanın tüm bloklarını serbest bırakır. Arena yeniden kullanılabilir (boş) hale gelir.
+ */
+void arena_release(Arena *arena);
+
+#endif // BESSAMBLY_ARENA_H
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "ast.h"
 #include "utils.h" // safe_malloc/safe_realloc için
 
@@ -16,10 +17,10 @@ static const char *get_stmt_type_name(StatementType type) {
     }
 }
 
-static void ast_operand_print(AST_Operand *opr) {
+static void ast_operand_print(const AST_Program *program, AST_Operand *opr) {
     switch (opr->type) {
         case OPR_TYPE_REGISTER:
-            printf("%s", opr->name);
+            printf("%s", ast_name(program, opr->name));
             break;
         case OPR_TYPE_MEMORY_ADDR:
             printf("MEM[0x%llX]", opr->mem_address);
@@ -30,12 +31,12 @@ static void ast_operand_print(AST_Operand *opr) {
     }
 }
 
-static void ast_expression_print(AST_Expr *expr) {
+static void ast_expression_print(const AST_Program *program, AST_Expr *expr) {
     if (expr->type == EXPR_TYPE_OPERAND) {
-        ast_operand_print(&expr->data.operand);
+        ast_operand_print(program, &expr->data.operand);
     } else if (expr->type == EXPR_TYPE_BINARY) {
         printf("(");
-        ast_operand_print(&expr->data.binary_op.left);
+        ast_operand_print(program, &expr->data.binary_op.left);
         printf(" %c ", 
             expr->data.binary_op.op == OP_BIN_ADD ? '+' :
             expr->data.binary_op.op == OP_BIN_SUB ? '-' :
@@ -43,91 +44,239 @@ static void ast_expression_print(AST_Expr *expr) {
             expr->data.binary_op.op == OP_BIN_DIV ? '/' :
             expr->data.binary_op.op == OP_BIN_AND ? '&' :
             '|'); // OP_BIN_OR
-        ast_operand_print(&expr->data.binary_op.right);
+        ast_operand_print(program, &expr->data.binary_op.right);
         printf(")");
     }
 }
 
+/**
+ * @brief Komut tablosu sütunlarını yeni kapasiteyle arenadan tahsis eder ve mevcut içeriği taşır.
+ * Eski sütunlar arena bırakılana kadar yerinde kalır; bu yüzden kapasite mümkünse
+ * ast_program_reserve ile tek seferde ayrılmalıdır.
+ */
+static void ast_program_resize(AST_Program *program, AST_StmtIndex capacity) {
+    size_t count = program->statement_count;
+    size_t cells = (size_t)capacity * AST_OPERAND_SLOTS;
+    
+    uint8_t *types = (uint8_t *)arena_alloc(&program->arena, capacity * sizeof(uint8_t));
+    uint8_t *ops = (uint8_t *)arena_alloc(&program->arena, capacity * sizeof(uint8_t));
+    int32_t *lines = (int32_t *)arena_alloc(&program->arena, capacity * sizeof(int32_t));
+    SymbolId *labels = (SymbolId *)arena_alloc(&program->arena, capacity * sizeof(SymbolId));
+    uint8_t *operand_types = (uint8_t *)arena_alloc(&program->arena, cells * sizeof(uint8_t));
+    int64_t *operand_values = (int64_t *)arena_alloc(&program->arena, cells * sizeof(int64_t));
+    
+    if (count > 0) {
+        memcpy(types, program->types, count * sizeof(uint8_t));
+        memcpy(ops, program->ops, count * sizeof(uint8_t));
+        memcpy(lines, program->lines, count * sizeof(int32_t));
+        memcpy(labels, program->labels, count * sizeof(SymbolId));
+        memcpy(operand_types, program->operand_types, count * AST_OPERAND_SLOTS * sizeof(uint8_t));
+        memcpy(operand_values, program->operand_values, count * AST_OPERAND_SLOTS * sizeof(int64_t));
+    }
+    
+    program->types = types;
+    program->ops = ops;
+    program->lines = lines;
+    program->labels = labels;
+    program->operand_types = operand_types;
+    program->operand_values = operand_values;
+    program->statement_capacity = capacity;
+}
+
+/**
+ * @brief Tabloya yeni bir komut satırı ekler (gerekirse kapasiteyi iki katına çıkarır).
+ * @return AST_StmtIndex: Eklenen komutun indeksi.
+ */
+static AST_StmtIndex ast_program_push(AST_Program *program, StatementType type, int line_number,
+                                      uint8_t op, SymbolId label) {
+    if (program->statement_count >= program->statement_capacity) {
+        AST_StmtIndex capacity = program->statement_capacity ? program->statement_capacity * 2 : 64;
+        ast_program_resize(program, capacity);
+    }
+    
+    AST_StmtIndex index = program->statement_count++;
+    program->types[index] = (uint8_t)type;
+    program->ops[index] = op;
+    program->lines[index] = line_number;
+    program->labels[index] = label;
+    return index;
+}
+
+/**
+ * @brief Bir operantı verilen komutun yuvasına sıkıştırarak yazar.
+ */
+static void ast_program_set_operand(AST_Program *program, AST_StmtIndex index, int slot, const AST_Operand *opr) {
+    size_t cell = (size_t)index * AST_OPERAND_SLOTS + (size_t)slot;
+    program->operand_types[cell] = (uint8_t)opr->type;
+    switch (opr->type) {
+        case OPR_TYPE_REGISTER:      program->operand_values[cell] = opr->name; break;
+        case OPR_TYPE_MEMORY_ADDR:   program->operand_values[cell] = opr->mem_address; break;
+        case OPR_TYPE_IMMEDIATE_INT: program->operand_values[cell] = opr->value; break;
+    }
+}
+
 // --- Program Yapısı İşlevleri ---
 
 AST_Program *ast_program_create() {
     AST_Program *program = (AST_Program *)safe_malloc(sizeof(AST_Program));
-    program->first_statement = NULL;
+    memset(program, 0, sizeof(AST_Program));
+    arena_init(&program->arena);
+    interner_init(&program->names);
     return program;
 }
 
-AST_Node *ast_node_create(StatementType type, int line_number) {
-    AST_Node *node = (AST_Node *)safe_malloc(sizeof(AST_Node));
-    node->type = type;
-    node->line_number = line_number;
-    node->next = NULL;
-    return node;
+void ast_program_reserve(AST_Program *program, AST_StmtIndex capacity) {
+    if (capacity > program->statement_capacity) {
+        ast_program_resize(program, capacity);
+    }
 }
 
-void ast_node_free(AST_Node *node) {
-    if (node == NULL) return;
-    // İç yapılar dinamik bellek tahsis etmediği için sadece düğümü serbest bırakıyoruz.
-    free(node);
+void ast_add_label_def(AST_Program *program, int line_number, SymbolId label) {
+    AST_StmtIndex index = ast_program_push(program, STMT_TYPE_LABEL_DEF, line_number, AST_OP_NONE, label);
+    memset(&program->operand_types[(size_t)index * AST_OPERAND_SLOTS], 0, AST_OPERAND_SLOTS);
 }
 
-void ast_program_free(AST_Program *program) {
-    if (program == NULL) return;
+void ast_add_assignment(AST_Program *program, int line_number, const AST_Operand *dest, const AST_Expr *expr) {
+    uint8_t op = expr->type == EXPR_TYPE_BINARY ? (uint8_t)expr->data.binary_op.op : AST_OP_NONE;
+    AST_StmtIndex index = ast_program_push(program, STMT_TYPE_ASSIGNMENT, line_number, op, SYMBOL_ID_NONE);
+    
+    ast_program_set_operand(program, index, AST_SLOT_DEST, dest);
+    if (expr->type == EXPR_TYPE_BINARY) {
+        ast_program_set_operand(program, index, AST_SLOT_LEFT, &expr->data.binary_op.left);
+        ast_program_set_operand(program, index, AST_SLOT_RIGHT, &expr->data.binary_op.right);
+    } else {
+        ast_program_set_operand(program, index, AST_SLOT_LEFT, &expr->data.operand);
+        program->operand_types[(size_t)index * AST_OPERAND_SLOTS + AST_SLOT_RIGHT] = 0;
+    }
+}
+
+void ast_add_goto(AST_Program *program, int line_number, SymbolId target) {
+    AST_StmtIndex index = ast_program_push(program, STMT_TYPE_GOTO, line_number, AST_OP_NONE, target);
+    memset(&program->operand_types[(size_t)index * AST_OPERAND_SLOTS], 0, AST_OPERAND_SLOTS);
+}
+
+void ast_add_if_goto(AST_Program *program, int line_number, const AST_Operand *left,
+                     ConditionOperatorType op, const AST_Operand *right, SymbolId target) {
+    AST_StmtIndex index = ast_program_push(program, STMT_TYPE_IF_GOTO, line_number, (uint8_t)op, target);
+    program->operand_types[(size_t)index * AST_OPERAND_SLOTS + AST_SLOT_DEST] = 0;
+    ast_program_set_operand(program, index, AST_SLOT_LEFT, left);
+    ast_program_set_operand(program, index, AST_SLOT_RIGHT, right);
+}
+
+AST_Expr ast_stmt_expression(const AST_Program *program, AST_StmtIndex index) {
+    AST_Expr expr = {0};
+    uint8_t op = program->ops[index];
     
-    AST_Node *current = program->first_statement;
-    AST_Node *next;
+    if (op == AST_OP_NONE) {
+        expr.type = EXPR_TYPE_OPERAND;
+        expr.data.operand = ast_stmt_operand(program, index, AST_SLOT_LEFT);
+    } else {
+        expr.type = EXPR_TYPE_BINARY;
+        expr.data.binary_op.op = (BinaryOperatorType)op;
+        expr.data.binary_op.left = ast_stmt_operand(program, index, AST_SLOT_LEFT);
+        expr.data.binary_op.right = ast_stmt_operand(program, index, AST_SLOT_RIGHT);
+    }
+    return expr;
+}
+
+void ast_program_splice(AST_Program *dest, AST_Program *src) {
+    if (src->statement_count == 0) return;
+    
+    AST_StmtIndex base = dest->statement_count;
+    AST_StmtIndex count = src->statement_count;
+    ast_program_reserve(dest, base + count);
     
-    // Bağlı listenin tüm düğümlerini dolaşarak serbest bırak
-    while (current != NULL) {
-        next = current->next;
-        ast_node_free(current);
-        current = next;
+    // Kaynak kimliklerini hedef isim havuzundaki kimliklere eşle (0: SYMBOL_ID_NONE)
+    uint32_t name_count = interner_count(&src->names);
+    SymbolId *remap = (SymbolId *)safe_malloc(((size_t)name_count + 1) * sizeof(SymbolId));
+    remap[SYMBOL_ID_NONE] = SYMBOL_ID_NONE;
+    for (SymbolId id = 1; id <= name_count; id++) {
+        remap[id] = interner_intern(&dest->names, interner_name(&src->names, id), interner_length(&src->names, id));
     }
     
+    // Sütunları toplu kopyala
+    memcpy(dest->types + base, src->types, count * sizeof(uint8_t));
+    memcpy(dest->ops + base, src->ops, count * sizeof(uint8_t));
+    memcpy(dest->lines + base, src->lines, count * sizeof(int32_t));
+    memcpy(dest->operand_types + (size_t)base * AST_OPERAND_SLOTS, src->operand_types,
+           (size_t)count * AST_OPERAND_SLOTS * sizeof(uint8_t));
+    memcpy(dest->operand_values + (size_t)base * AST_OPERAND_SLOTS, src->operand_values,
+           (size_t)count * AST_OPERAND_SLOTS * sizeof(int64_t));
+    
+    // İsim kimliklerini yeniden eşle
+    for (AST_StmtIndex i = 0; i < count; i++) {
+        dest->labels[base + i] = remap[src->labels[i]];
+    }
+    size_t first_cell = (size_t)base * AST_OPERAND_SLOTS;
+    size_t cells = (size_t)count * AST_OPERAND_SLOTS;
+    for (size_t c = first_cell; c < first_cell + cells; c++) {
+        if (dest->operand_types[c] == OPR_TYPE_REGISTER) {
+            dest->operand_values[c] = remap[dest->operand_values[c]];
+        }
+    }
+    
+    free(remap);
+    dest->statement_count = base + count;
+}
+
+void ast_program_free(AST_Program *program) {
+    if (program == NULL) return;
+    
+    // Komut tablosu tek tek değil, arena ile toplu olarak serbest bırakılır
+    arena_release(&program->arena);
+    interner_free(&program->names);
     free(program);
 }
 
+size_t ast_program_footprint(const AST_Program *program) {
+    return sizeof(AST_Program) + program->arena.reserved_bytes + interner_footprint(&program->names);
+}
+
 // --- Debug/Yazdırma İşlevi ---
 
 void ast_print(AST_Program *program) {
-    if (program == NULL || program->first_statement == NULL) {
+    if (program == NULL || program->statement_count == 0) {
         printf("AST Boş.\n");
         return;
     }
 
-    AST_Node *current = program->first_statement;
     printf("\n--- Bessambly AST Başlangıcı ---\n");
     
-    int stmt_index = 0;
-    while (current != NULL) {
-        printf("[%03d] (Satır %d) %s: ", stmt_index++, current->line_number, get_stmt_type_name(current->type));
+    for (AST_StmtIndex i = 0; i < program->statement_count; i++) {
+        StatementType type = ast_stmt_type(program, i);
+        printf("[%03u] (Satır %d) %s: ", i, ast_stmt_line(program, i), get_stmt_type_name(type));
         
-        switch (current->type) {
+        switch (type) {
             case STMT_TYPE_LABEL_DEF:
-                printf("%s:\n", current->data.label_def.label_name);
+                printf("%s:\n", ast_name(program, ast_stmt_label(program, i)));
                 break;
                 
-            case STMT_TYPE_ASSIGNMENT:
-                ast_operand_print(&current->data.assignment.destination);
+            case STMT_TYPE_ASSIGNMENT: {
+                AST_Operand dest = ast_stmt_operand(program, i, AST_SLOT_DEST);
+                AST_Expr expr = ast_stmt_expression(program, i);
+                ast_operand_print(program, &dest);
                 printf(" = ");
-                ast_expression_print(&current->data.assignment.expression);
+                ast_expression_print(program, &expr);
                 printf("\n");
                 break;
+            }
                 
             case STMT_TYPE_GOTO:
-                printf("goto %s\n", current->data.goto_stmt.target_label);
+                printf("goto %s\n", ast_name(program, ast_stmt_label(program, i)));
                 break;
                 
-            case STMT_TYPE_IF_GOTO:
+            case STMT_TYPE_IF_GOTO: {
+                AST_Operand left = ast_stmt_operand(program, i, AST_SLOT_LEFT);
+                AST_Operand right = ast_stmt_operand(program, i, AST_SLOT_RIGHT);
                 printf("if ");
-                ast_operand_print(&current->data.if_goto_stmt.left);
+                ast_operand_print(program, &left);
                 // Operatör Sembolünü Yazdır
                 printf(" [OP] "); 
-                ast_operand_print(&current->data.if_goto_stmt.right);
-                printf(" goto %s\n", current->data.if_goto_stmt.target_label);
+                ast_operand_print(program, &right);
+                printf(" goto %s\n", ast_name(program, ast_stmt_label(program, i)));
                 break;
+            }
         }
-        
-        current = current->next;
     }
     printf("--- Bessambly AST Sonu ---\n");
 }
\ No newline at end of file
@@ -3,12 +3,16 @@
 
 #include <stddef.h>
 #include <stdbool.h>
-#include "utils.h" // MAX_LABEL_LENGTH için
+#include <stdint.h>
+#include "arena.h" // Komut tablosu sütunlarının tahsisi için
+#include "interner.h" // Kayıt/etiket isim kimlikleri için
 
 // --- İleri Bildirimler ---
-typedef struct AST_Node AST_Node;
 typedef struct AST_Program AST_Program;
 
+// Komut tablosundaki bir komutun 32-bit indeksi
+typedef uint32_t AST_StmtIndex;
+
 // --- 1. Temel Yapılar: Operandlar ve İfadeler ---
 
 // Operant Tipi: İşlemlerde kullanılan değerin kaynağını/hedefini belirtir.
@@ -18,24 +22,15 @@ typedef enum {
     OPR_TYPE_IMMEDIATE_INT // Anlık Tamsayı Sabiti (örn: 10, 0xFF)
 } OperandType;
 
-// Bellek Erişim Tipi
-typedef enum {
-    MEM_ACCESS_NONE = 0, // Bellek erişimi yok (kayıt veya sabit)
-    MEM_ACCESS_FIXED,    // Sabit adres (örn: MEM[0x100])
-    // Not: Bessambly'de sadece sabit adres desteklenir.
-} MemAccessType;
-
 
 // Tek bir operantı temsil eder (A, 10, MEM[0x50])
+// Not: Bu yapı AST'de saklanmaz; komut tablosundaki sıkıştırılmış sütunlardan
+// ast_stmt_operand ile çözülen bir görünümdür (view).
+// Bessambly'de sadece sabit bellek adresleri desteklenir.
 typedef struct {
     OperandType type;
-    char name[MAX_LABEL_LENGTH]; // Kayıt adı veya Etiket adı (eğer REGISTER ise)
-    
-    // Değerler
-    long long int value; // Eğer OPR_TYPE_IMMEDIATE_INT ise
-    
-    // Bellek erişim detayları
-    MemAccessType mem_type;
+    SymbolId name;             // Kayıt adının kimliği (eğer REGISTER ise), ast_name ile okunur
+    long long int value;       // Eğer OPR_TYPE_IMMEDIATE_INT ise
     long long int mem_address; // Eğer MEMORY_ADDR ise
 } AST_Operand;
 
@@ -94,49 +89,88 @@ typedef enum {
 } StatementType;
 
 
-// Her bir komutu temsil eden ana AST Düğümü
-struct AST_Node {
-    StatementType type;
-    int line_number; // Hata raporlama ve debug için satır numarası
-    
-    union {
-        // STMT_TYPE_LABEL_DEF
-        struct {
-            char label_name[MAX_LABEL_LENGTH];
-        } label_def;
-        
-        // STMT_TYPE_ASSIGNMENT
-        struct {
-            AST_Operand destination; // Atama hedefi (örn: C veya MEM[0x10])
-            AST_Expr expression;     // Atanan ifade (örn: A + B veya sadece 10)
-        } assignment;
-        
-        // STMT_TYPE_GOTO
-        struct {
-            char target_label[MAX_LABEL_LENGTH];
-        } goto_stmt;
-        
-        // STMT_TYPE_IF_GOTO
-        struct {
-            AST_Operand left;
-            ConditionOperatorType op;
-            AST_Operand right;
-            char target_label[MAX_LABEL_LENGTH];
-        } if_goto_stmt;
-    } data;
-    
-    AST_Node *next; // Program akışındaki bir sonraki komuta işaret eder
-};
+// Tek operantlı atamalarda (A = B) işlem sütununa yazılan değer
+#define AST_OP_NONE 0xFF
+
+// Komut başına operant yuvası sayısı ve yuvaların anlamı
+#define AST_OPERAND_SLOTS 3
+#define AST_SLOT_DEST  0 // ASSIGNMENT: Atama hedefi (örn: C veya MEM[0x10])
+#define AST_SLOT_LEFT  1 // ASSIGNMENT: İfadenin (sol) operantı, IF_GOTO: Sol operant
+#define AST_SLOT_RIGHT 2 // ASSIGNMENT: İkili ifadenin sağ operantı, IF_GOTO: Sağ operant
 
 
 // --- 3. Program Yapısı ---
 
-// Tüm programı temsil eden kök düğüm
+// Tüm programı temsil eden düz komut tablosu (Structure of Arrays)
+// i. komutun alanları her sütunun i. elemanındadır (operant sütunlarında i * AST_OPERAND_SLOTS + yuva).
+// Komutlar arasında işaretçi yoktur; tüm geçişler tabloyu doğrusal olarak dolaşır.
+// Sütunlar programa ait arenadan tahsis edilir; AST tek bir arena_release ile serbest bırakılır.
 struct AST_Program {
-    AST_Node *first_statement; // Bağlı listenin başı
+    AST_StmtIndex statement_count;    // Toplam komut sayısı
+    AST_StmtIndex statement_capacity; // Sütunların kapasitesi (komut cinsinden)
+    
+    uint8_t *types;          // StatementType
+    uint8_t *ops;            // BinaryOperatorType / ConditionOperatorType (AST_OP_NONE: tek operant)
+    int32_t *lines;          // Hata raporlama ve debug için satır numarası
+    SymbolId *labels;        // LABEL_DEF: etiket adı, GOTO/IF_GOTO: hedef etiket
+    uint8_t *operand_types;  // OperandType
+    int64_t *operand_values; // Sabit değer, bellek adresi veya isim kimliği (tipe göre)
+    
+    Interner names; // Programdaki tüm kayıt ve etiket isimleri (Lexer tarafından doldurulur)
+    
+    Arena arena; // Sütunların tahsis edildiği bölge
 };
 
 
+// --- Komut Tablosu Erişimcileri ---
+
+static inline StatementType ast_stmt_type(const AST_Program *program, AST_StmtIndex index) {
+    return (StatementType)program->types[index];
+}
+
+static inline int ast_stmt_line(const AST_Program *program, AST_StmtIndex index) {
+    return program->lines[index];
+}
+
+static inline SymbolId ast_stmt_label(const AST_Program *program, AST_StmtIndex index) {
+    return program->labels[index];
+}
+
+/**
+ * @brief Bir isim kimliğinin metnini döndürür (yalnızca hata mesajları ve debug çıktısı için).
+ */
+static inline const char *ast_name(const AST_Program *program, SymbolId name) {
+    return interner_name(&program->names, name);
+}
+
+/**
+ * @brief Bir komutun verilen yuvasındaki operantı sıkıştırılmış sütunlardan çözer.
+ */
+static inline AST_Operand ast_stmt_operand(const AST_Program *program, AST_StmtIndex index, int slot) {
+    size_t cell = (size_t)index * AST_OPERAND_SLOTS + (size_t)slot;
+    AST_Operand operand = {0};
+    operand.type = (OperandType)program->operand_types[cell];
+    switch (operand.type) {
+        case OPR_TYPE_REGISTER:      operand.name = (SymbolId)program->operand_values[cell]; break;
+        case OPR_TYPE_MEMORY_ADDR:   operand.mem_address = program->operand_values[cell]; break;
+        case OPR_TYPE_IMMEDIATE_INT: operand.value = program->operand_values[cell]; break;
+    }
+    return operand;
+}
+
+/**
+ * @brief Bir atama komutunun sağ tarafındaki ifadeyi çözer.
+ */
+AST_Expr ast_stmt_expression(const AST_Program *program, AST_StmtIndex index);
+
+/**
+ * @brief Bir if-goto komutunun koşul operatörünü döndürür.
+ */
+static inline ConditionOperatorType ast_stmt_condition(const AST_Program *program, AST_StmtIndex index) {
+    return (ConditionOperatorType)program->ops[index];
+}
+
+
 // --- AST İşlev Prototipleri ---
 
 /**
@@ -145,15 +179,50 @@ struct AST_Program {
 AST_Program *ast_program_create();
 
 /**
- * @brief Bir komut düğümü (AST_Node) oluşturur ve belleği tahsis eder.
+ * @brief Komut tablosu için en az capacity komutluk yer ayırır (tek seferde, arenadan).
+ * Ayrıştırıcı kaynak koddaki satır sayısını üst sınır tahmini olarak kullanır.
  */
-AST_Node *ast_node_create(StatementType type, int line_number);
+void ast_program_reserve(AST_Program *program, AST_StmtIndex capacity);
 
 /**
- * @brief Tüm AST yapısını ve bağlı düğümleri serbest bırakır.
+ * @brief Komut tablosuna etiket tanımı (LOOP_START:) ekler.
+ */
+void ast_add_label_def(AST_Program *program, int line_number, SymbolId label);
+
+/**
+ * @brief Komut tablosuna atama (dest = expr) ekler.
+ */
+void ast_add_assignment(AST_Program *program, int line_number, const AST_Operand *dest, const AST_Expr *expr);
+
+/**
+ * @brief Komut tablosuna koşulsuz atlama (goto TARGET) ekler.
+ */
+void ast_add_goto(AST_Program *program, int line_number, SymbolId target);
+
+/**
+ * @brief Komut tablosuna koşullu atlama (if A > B goto TARGET) ekler.
+ */
+void ast_add_if_goto(AST_Program *program, int line_number, const AST_Operand *left,
+                     ConditionOperatorType op, const AST_Operand *right, SymbolId target);
+
+/**
+ * @brief Kaynak programın komut tablosunu ve isim havuzunu hedef programın sonuna ekler.
+ * Sütunlar toplu olarak kopyalanır (memcpy); kaynak programın isim kimlikleri hedefin
+ * isim havuzuna eklenir ve komutlardaki kimlikler yeniden eşlenir.
+ * Kaynak program değişmez ve ayrıca serbest bırakılmalıdır.
+ */
+void ast_program_splice(AST_Program *dest, AST_Program *src);
+
+/**
+ * @brief Tüm AST yapısını serbest bırakır (komut tablosu tek bir arena bırakma işlemiyle).
  */
 void ast_program_free(AST_Program *program);
 
+/**
+ * @brief AST'nin bellek kullanımını bayt cinsinden döndürür (arena blokları dahil).
+ */
+size_t ast_program_footprint(const AST_Program *program);
+
 /**
  * @brief (DEBUG) AST'yi konsola yazdırmak için yardımcı işlev.
  */
@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cfg.h"
+#include "utils.h" // safe_malloc için
+
+// --- Talimat Özellikleri ---
+
+int cfg_instruction_uses(const Instruction *inst, Register uses[2]) {
+    int count = 0;
+    switch (inst->type) {
+        // rs1 ve rs2 okunur
+        case I_ADD: case I_SUB: case I_AND: case I_OR: case I_XOR:
+        case I_SLL: case I_SRL: case I_SRA: case I_SLT: case I_SLTU:
+        case I_MUL: case I_MULH: case I_MULHSU: case I_MULHU:
+        case I_DIV: case I_DIVU: case I_REM: case I_REMU:
+        case I_SW: case I_SH: case I_SB:
+        case I_BEQ: case I_BNE: case I_BLT: case I_BGE: case I_BLTU: case I_BGEU:
+        case I_A_CALL: // Argümanlar T0/T1
+            if (inst->rs1 != R_ZERO) uses[count++] = inst->rs1;
+            if (inst->rs2 != R_ZERO && inst->rs2 != inst->rs1) uses[count++] = inst->rs2;
+            break;
+        // Yalnızca rs1 okunur
+        case I_ADDI: case I_ANDI: case I_ORI: case I_XORI: case I_SLTI: case I_SLTIU:
+        case I_SLLI: case I_SRLI: case I_SRAI:
+        case I_LW: case I_LH: case I_LHU: case I_LB: case I_LBU: case I_JALR:
+            if (inst->rs1 != R_ZERO) uses[count++] = inst->rs1;
+            break;
+        default:
+            break;
+    }
+    return count;
+}
+
+Register cfg_instruction_def(const Instruction *inst) {
+    switch (inst->type) {
+        case I_ADD: case I_SUB: case I_AND: case I_OR: case I_XOR:
+        case I_SLL: case I_SRL: case I_SRA: case I_SLT: case I_SLTU:
+        case I_MUL: case I_MULH: case I_MULHSU: case I_MULHU:
+        case I_DIV: case I_DIVU: case I_REM: case I_REMU:
+        case I_ADDI: case I_ANDI: case I_ORI: case I_XORI: case I_SLTI: case I_SLTIU:
+        case I_SLLI: case I_SRLI: case I_SRAI:
+        case I_LW: case I_LH: case I_LHU: case I_LB: case I_LBU:
+        case I_LUI: case I_AUIPC:
+        case I_JAL: case I_JALR:
+            return inst->rd;
+        case I_A_CALL:
+            return R_T0; // Sonuç; dönüş adresi (T2) ve rutinin bozduğu T1/T5/T6/tp izlenmez
+        default:
+            return R_ZERO;
+    }
+}
+
+bool cfg_is_terminator(InstructionType type) {
+    switch (type) {
+        case I_BEQ: case I_BNE: case I_BLT: case I_BGE: case I_BLTU: case I_BGEU:
+        case I_JAL: case I_JALR: case I_A_HALT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool cfg_is_branch(InstructionType type) {
+    return type == I_BEQ || type == I_BNE || type == I_BLT || type == I_BGE ||
+           type == I_BLTU || type == I_BGEU;
+}
+
+InstructionType cfg_invert_branch(InstructionType type) {
+    switch (type) {
+        case I_BEQ:  return I_BNE;
+        case I_BNE:  return I_BEQ;
+        case I_BLT:  return I_BGE;
+        case I_BGE:  return I_BLT;
+        case I_BLTU: return I_BGEU;
+        default:     return I_BLTU; // I_BGEU
+    }
+}
+
+// --- CFG Oluşturma ---
+
+ControlFlowGraph *cfg_build(const CodeBuffer *buffer) {
+    size_t count = buffer->count;
+    const Instruction *instructions = buffer->instructions;
+
+    ControlFlowGraph *cfg = (ControlFlowGraph *)safe_malloc(sizeof(ControlFlowGraph));
+    memset(cfg, 0, sizeof(ControlFlowGraph));
+
+    // Etiket kimliği -> talimat indeksi tablosu ve izlenecek kayıt sayısı
+    SymbolId max_label = SYMBOL_ID_NONE;
+    uint32_t max_register = R_COUNT - 1;
+    for (size_t i = 0; i < count; i++) {
+        const Instruction *inst = &instructions[i];
+        if (inst->label > max_label) max_label = inst->label;
+        if ((uint32_t)inst->rd > max_register) max_register = inst->rd;
+        if ((uint32_t)inst->rs1 > max_register) max_register = inst->rs1;
+        if ((uint32_t)inst->rs2 > max_register) max_register = inst->rs2;
+    }
+    cfg->register_count = max_register + 1;
+
+    // 1. Blok başlangıçlarını (leader) işaretle: ilk talimat, etiketler, sonlandırıcılardan sonrası
+    uint8_t *leader = (uint8_t *)safe_malloc(count + 1);
+    memset(leader, 0, count + 1);
+    if (count > 0) leader[0] = 1;
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].type == I_A_LABEL) leader[i] = 1;
+        if (cfg_is_terminator(instructions[i].type)) leader[i + 1] = 1;
+    }
+
+    size_t block_count = 0;
+    for (size_t i = 0; i < count; i++) block_count += leader[i];
+    cfg->blocks = (BasicBlock *)safe_malloc((block_count + 1) * sizeof(BasicBlock));
+    cfg->block_count = block_count;
+
+    int *block_of = (int *)safe_malloc((count + 1) * sizeof(int));
+    int *label_block = (int *)safe_malloc(((size_t)max_label + 1) * sizeof(int));
+    for (SymbolId id = 0; id <= max_label; id++) label_block[id] = CFG_NO_BLOCK;
+
+    size_t b = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (leader[i] && i > 0) b++;
+        if (leader[i]) {
+            cfg->blocks[b].start = i;
+            cfg->blocks[b].loop_depth = 0;
+        }
+        cfg->blocks[b].end = i + 1;
+        block_of[i] = (int)b;
+        if (instructions[i].type == I_A_LABEL) label_block[instructions[i].label] = (int)b;
+    }
+
+    // 2. Ardıllar ve döngü derinliği (geri atlama [hedef, atlama] aralığını kapsar)
+    int *depth_delta = (int *)safe_malloc((block_count + 1) * sizeof(int));
+    memset(depth_delta, 0, (block_count + 1) * sizeof(int));
+
+    for (size_t k = 0; k < block_count; k++) {
+        BasicBlock *block = &cfg->blocks[k];
+        const Instruction *last = &instructions[block->end - 1];
+        int fallthrough = (k + 1 < block_count) ? (int)(k + 1) : CFG_NO_BLOCK;
+        bool jumps = last->label != SYMBOL_ID_NONE && last->type != I_A_LABEL && last->type != I_A_CALL;
+        int target = jumps ? label_block[last->label] : CFG_NO_BLOCK;
+
+        block->successors[0] = CFG_NO_BLOCK;
+        block->successors[1] = CFG_NO_BLOCK;
+        switch (last->type) {
+            case I_BEQ: case I_BNE: case I_BLT: case I_BGE: case I_BLTU: case I_BGEU:
+                block->successors[0] = fallthrough;
+                block->successors[1] = target;
+                break;
+            case I_JAL:
+                block->successors[0] = target;
+                break;
+            case I_JALR: case I_A_HALT:
+                break; // Program sonu veya dolaylı atlama
+            default:
+                block->successors[0] = fallthrough;
+                break;
+        }
+
+        if (target != CFG_NO_BLOCK && (size_t)target <= k) {
+            depth_delta[target]++;
+            depth_delta[k + 1]--;
+        }
+    }
+
+    int depth = 0;
+    for (size_t k = 0; k < block_count; k++) {
+        depth += depth_delta[k];
+        cfg->blocks[k].loop_depth = depth;
+    }
+
+    free(depth_delta);
+    free(label_block);
+    free(block_of);
+    free(leader);
+    return cfg;
+}
+
+// --- Canlılık Analizi ---
+
+// Büyüyebilen kayıt listesi (blok başına gen/kill kümeleri için)
+typedef struct {
+    Register *items;
+    size_t count;
+    size_t capacity;
+} RegisterList;
+
+static void register_list_push(RegisterList *list, Register r) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        list->items = (Register *)safe_realloc(list->items, list->capacity * sizeof(Register));
+    }
+    list->items[list->count++] = r;
+}
+
+void cfg_compute_liveness(ControlFlowGraph *cfg, const CodeBuffer *buffer) {
+    size_t block_count = cfg->block_count;
+    uint32_t register_count = cfg->register_count;
+
+    free(cfg->global_index);
+    free(cfg->global_registers);
+    free(cfg->live_in);
+    free(cfg->live_out);
+
+    // 1. Blok başına yukarı açık kullanımlar (gen) ve tanımlar (kill) listeleri;
+    // blok k'nın listesi gen.items[gen_start[k] .. gen_start[k + 1]) aralığındadır
+    RegisterList gen = {0}, kill = {0};
+    size_t *gen_start = (size_t *)safe_malloc((block_count + 1) * sizeof(size_t));
+    size_t *kill_start = (size_t *)safe_malloc((block_count + 1) * sizeof(size_t));
+    uint32_t *used_in = (uint32_t *)safe_malloc(((size_t)register_count + 1) * sizeof(uint32_t));
+    uint32_t *defined_in = (uint32_t *)safe_malloc(((size_t)register_count + 1) * sizeof(uint32_t));
+    memset(used_in, 0, ((size_t)register_count + 1) * sizeof(uint32_t));
+    memset(defined_in, 0, ((size_t)register_count + 1) * sizeof(uint32_t));
+
+    for (size_t k = 0; k < block_count; k++) {
+        uint32_t stamp = (uint32_t)k + 1;
+        gen_start[k] = gen.count;
+        kill_start[k] = kill.count;
+        for (size_t i = cfg->blocks[k].start; i < cfg->blocks[k].end; i++) {
+            Register uses[2];
+            int use_count = cfg_instruction_uses(&buffer->instructions[i], uses);
+            for (int u = 0; u < use_count; u++) {
+                if (defined_in[uses[u]] == stamp || used_in[uses[u]] == stamp) continue;
+                used_in[uses[u]] = stamp;
+                register_list_push(&gen, uses[u]);
+            }
+            Register def = cfg_instruction_def(&buffer->instructions[i]);
+            if (def != R_ZERO && defined_in[def] != stamp) {
+                defined_in[def] = stamp;
+                register_list_push(&kill, def);
+            }
+        }
+    }
+    gen_start[block_count] = gen.count;
+    kill_start[block_count] = kill.count;
+    free(defined_in);
+
+    // 2. Yukarı açık kullanımı olan kayıtlar kayıt sırasıyla yoğun numaralanır
+    // (used_in burada "bir blokta yukarı açık" işareti olarak yeniden kullanılır)
+    cfg->global_index = (uint32_t *)safe_malloc(((size_t)register_count + 1) * sizeof(uint32_t));
+    cfg->global_count = 0;
+    for (uint32_t r = 0; r < register_count; r++) {
+        cfg->global_index[r] = used_in[r] != 0 ? cfg->global_count++ : CFG_NOT_GLOBAL;
+    }
+    free(used_in);
+    cfg->global_registers = (Register *)safe_malloc(((size_t)cfg->global_count + 1) * sizeof(Register));
+    for (uint32_t r = 0; r < register_count; r++) {
+        if (cfg->global_index[r] != CFG_NOT_GLOBAL) cfg->global_registers[cfg->global_index[r]] = (Register)r;
+    }
+
+    size_t words = ((size_t)cfg->global_count + 63) / 64;
+    size_t set_bytes = block_count * words * sizeof(uint64_t);
+    cfg->words = words;
+    cfg->live_in = (uint64_t *)safe_malloc(set_bytes + sizeof(uint64_t));
+    cfg->live_out = (uint64_t *)safe_malloc(set_bytes + sizeof(uint64_t));
+    memset(cfg->live_in, 0, set_bytes);
+    memset(cfg->live_out, 0, set_bytes);
+
+    // 3. Öncül listeleri: Girişi değişen bloğun öncülleri yeniden işlenir
+    size_t *pred_start = (size_t *)safe_malloc((block_count + 1) * sizeof(size_t));
+    memset(pred_start, 0, (block_count + 1) * sizeof(size_t));
+    for (size_t k = 0; k < block_count; k++) {
+        for (int s = 0; s < 2; s++) {
+            int succ = cfg->blocks[k].successors[s];
+            if (succ != CFG_NO_BLOCK) pred_start[succ + 1]++;
+        }
+    }
+    for (size_t k = 0; k < block_count; k++) pred_start[k + 1] += pred_start[k];
+    uint32_t *preds = (uint32_t *)safe_malloc((pred_start[block_count] + 1) * sizeof(uint32_t));
+    size_t *pred_fill = (size_t *)safe_malloc((block_count + 1) * sizeof(size_t));
+    memcpy(pred_fill, pred_start, block_count * sizeof(size_t));
+    for (size_t k = 0; k < block_count; k++) {
+        for (int s = 0; s < 2; s++) {
+            int succ = cfg->blocks[k].successors[s];
+            if (succ != CFG_NO_BLOCK) preds[pred_fill[succ]++] = (uint32_t)k;
+        }
+    }
+    free(pred_fill);
+
+    // 4. Geriye doğru veri akışı: out(b) = U in(s), in(b) = gen(b) U (out(b) - kill(b)).
+    // Bloklar sondan başa turlarla işlenir; girişi değişmeyen bloğun öncülleri yeniden
+    // hesaplanmaz (dirty). Yalnızca global kayıtların bitleri tutulur.
+    bool *dirty = (bool *)safe_malloc(block_count + 1);
+    uint64_t *in = (uint64_t *)safe_malloc((words + 1) * sizeof(uint64_t));
+    memset(dirty, 1, block_count + 1);
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t b = block_count; b-- > 0;) {
+            if (!dirty[b]) continue;
+            dirty[b] = false;
+
+            uint64_t *out = cfg_live_out(cfg, b);
+            for (int s = 0; s < 2; s++) {
+                int succ = cfg->blocks[b].successors[s];
+                if (succ == CFG_NO_BLOCK) continue;
+                const uint64_t *succ_in = cfg_live_in(cfg, (size_t)succ);
+                for (size_t w = 0; w < words; w++) out[w] |= succ_in[w];
+            }
+
+            memcpy(in, out, words * sizeof(uint64_t));
+            for (size_t d = kill_start[b]; d < kill_start[b + 1]; d++) {
+                uint32_t g = cfg->global_index[kill.items[d]];
+                if (g != CFG_NOT_GLOBAL) in[g >> 6] &= ~((uint64_t)1 << (g & 63));
+            }
+            for (size_t u = gen_start[b]; u < gen_start[b + 1]; u++) {
+                uint32_t g = cfg->global_index[gen.items[u]];
+                CFG_SET_ADD(in, g);
+            }
+
+            uint64_t *block_in = cfg_live_in(cfg, b);
+            if (memcmp(in, block_in, words * sizeof(uint64_t)) == 0) continue;
+            memcpy(block_in, in, words * sizeof(uint64_t));
+            for (size_t p = pred_start[b]; p < pred_start[b + 1]; p++) dirty[preds[p]] = true;
+            changed = true;
+        }
+    }
+
+    free(in);
+    free(dirty);
+    free(preds);
+    free(pred_start);
+    free(kill_start);
+    free(gen_start);
+    free(kill.items);
+    free(gen.items);
+}
+
+void cfg_free(ControlFlowGraph *cfg) {
+    if (cfg == NULL) return;
+    free(cfg->blocks);
+    free(cfg->global_index);
+    free(cfg->global_registers);
+    free(cfg->live_in);
+    free(cfg->live_out);
+    free(cfg);
+}
@@ -0,0 +1,127 @@
+#ifndef BESSAMBLY_CFG_H
+#define BESSAMBLY_CFG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+
+// Kontrol Akış Grafiği (Control Flow Graph) ve Canlılık (Liveness) Analizi
+// Talimat arabelleği (yerleşimden önce, I_A_LABEL sanal komutlarıyla birlikte) temel
+// bloklara ayrılır. Kayıt atayıcı ve veri akışı geçişleri bu modülü ortak kullanır.
+
+#define CFG_NO_BLOCK (-1)
+
+// Temel blok: [start, end) aralığındaki talimatlar
+typedef struct {
+    size_t start;
+    size_t end;
+    int successors[2]; // Ardıl bloklar (CFG_NO_BLOCK: yok)
+    int loop_depth;    // Bloğu kapsayan döngü sayısı (geri atlamalardan hesaplanır)
+} BasicBlock;
+
+#define CFG_NOT_GLOBAL UINT32_MAX // Blok sınırını aşmayan kaydın yoğun numarası
+
+typedef struct {
+    BasicBlock *blocks;
+    size_t block_count;
+    uint32_t register_count; // En büyük kayıt numarası + 1
+
+    // Canlılık yalnızca blok sınırını aşabilen ("global") kayıtlar için tutulur: Bir blokta
+    // tanımından önce okunan her kayıt, kayıt sırasıyla 0..global_count-1 arasında yoğun bir
+    // numara alır. Tanımlandığı blokta ölen kayıtlar kümelere girmez; tüketiciler onları blok
+    // içinde geriye doğru tarayarak bulur. Her blok için global_count bitlik küme (words kelime).
+    uint32_t *global_index;     // Kayıt -> yoğun numara (CFG_NOT_GLOBAL: blok sınırını aşmaz)
+    Register *global_registers; // Yoğun numara -> kayıt
+    uint32_t global_count;
+    size_t words;
+    uint64_t *live_in;
+    uint64_t *live_out;
+} ControlFlowGraph;
+
+// Bit kümesi yardımcıları
+#define CFG_SET_HAS(set, r) (((set)[(r) >> 6] >> ((r) & 63)) & 1u)
+#define CFG_SET_ADD(set, r) ((set)[(r) >> 6] |= (uint64_t)1 << ((r) & 63))
+
+/**
+ * @brief Talimat arabelleğinden temel blokları ve ardıl ilişkilerini oluşturur.
+ */
+ControlFlowGraph *cfg_build(const CodeBuffer *buffer);
+
+/**
+ * @brief Her blok için canlı giriş/çıkış kümelerini (live_in/live_out) hesaplar.
+ * Kümeler yalnızca global kayıtları kapsar; bellek blok sayısı x global kayıt sayısıyla,
+ * tüm kayıtların sayısıyla değil, orantılıdır.
+ */
+void cfg_compute_liveness(ControlFlowGraph *cfg, const CodeBuffer *buffer);
+
+/**
+ * @brief Bloğun canlı giriş kümesini döndürür (yoğun numaralarla).
+ */
+static inline uint64_t *cfg_live_in(const ControlFlowGraph *cfg, size_t block) {
+    return cfg->live_in + block * cfg->words;
+}
+
+/**
+ * @brief Bloğun canlı çıkış kümesini döndürür (yoğun numaralarla).
+ */
+static inline uint64_t *cfg_live_out(const ControlFlowGraph *cfg, size_t block) {
+    return cfg->live_out + block * cfg->words;
+}
+
+/**
+ * @brief Kaydın canlılık kümesinde olup olmadığını kontrol eder.
+ */
+static inline bool cfg_set_contains(const ControlFlowGraph *cfg, const uint64_t *set, Register r) {
+    uint32_t g = (uint32_t)r < cfg->register_count ? cfg->global_index[r] : CFG_NOT_GLOBAL;
+    return g != CFG_NOT_GLOBAL && CFG_SET_HAS(set, g);
+}
+
+/**
+ * @brief Kümenin position ve sonrasındaki ilk üyesinin yoğun numarasını döndürür.
+ * @return uint32_t: Üye yoksa global_count.
+ */
+static inline uint32_t cfg_set_next(const ControlFlowGraph *cfg, const uint64_t *set, uint32_t position) {
+    size_t w = position >> 6;
+    if (w >= cfg->words) return cfg->global_count;
+    uint64_t bits = set[w] & (~(uint64_t)0 << (position & 63));
+    while (bits == 0) {
+        if (++w == cfg->words) return cfg->global_count;
+        bits = set[w];
+    }
+    return (uint32_t)(w * 64 + (size_t)__builtin_ctzll(bits));
+}
+
+/**
+ * @brief Talimatın okuduğu kayıtları döndürür (x0 hariç).
+ * @param uses: En az 2 elemanlı çıktı dizisi.
+ * @return int: Okunan kayıt sayısı.
+ */
+int cfg_instruction_uses(const Instruction *inst, Register uses[2]);
+
+/**
+ * @brief Talimatın yazdığı kaydı döndürür (yazmıyorsa veya x0'a yazıyorsa R_ZERO).
+ */
+Register cfg_instruction_def(const Instruction *inst);
+
+/**
+ * @brief Talimatın bir temel bloğu sonlandırıp sonlandırmadığını kontrol eder (atlama/HALT).
+ */
+bool cfg_is_terminator(InstructionType type);
+
+/**
+ * @brief Talimatın koşullu dallanma (BEQ, BNE, BLT, BGE, BLTU, BGEU) olup olmadığını kontrol eder.
+ */
+bool cfg_is_branch(InstructionType type);
+
+/**
+ * @brief Koşulun tersini veren dallanma talimatını döndürür (BEQ <-> BNE, BLT <-> BGE, BLTU <-> BGEU).
+ */
+InstructionType cfg_invert_branch(InstructionType type);
+
+/**
+ * @brief CFG için ayrılan belleği serbest bırakır.
+ */
+void cfg_free(ControlFlowGraph *cfg);
+
+#endif // BESSAMBLY_CFG_H
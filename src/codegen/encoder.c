@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "encoder.h"
+#include "error.h"
+
+// Biçimin kullandığı kayıt alanları
+#define FIELD_RD  0x1
+#define FIELD_RS1 0x2
+#define FIELD_RS2 0x4
+
+// Biçim başına operant kuralları: Hangi kayıt alanları kodlanır ve sabit hangi aralıkta olmalıdır
+typedef struct {
+    uint8_t fields;     // FIELD_* bayrakları
+    int32_t min, max;   // Sabitin geçerli aralığı [min, max]
+    int32_t align_mask; // Sabitin sıfır olması gereken alt bitleri (B/J: 2 bayt hizalı)
+    const char *description;
+} FormatRule;
+
+static const FormatRule format_rules[ENC_FORMAT_COUNT] = {
+    [ENC_NONE]    = {0, INT32_MIN, INT32_MAX, 0, ""},
+    [ENC_R]       = {FIELD_RD | FIELD_RS1 | FIELD_RS2, INT32_MIN, INT32_MAX, 0, ""},
+    [ENC_I]       = {FIELD_RD | FIELD_RS1, -2048, 2047, 0, "12-bit işaretli sabit/ofset"},
+    [ENC_I_SHIFT] = {FIELD_RD | FIELD_RS1, 0, 31, 0, "5-bit kaydırma miktarı"},
+    [ENC_S]       = {FIELD_RS1 | FIELD_RS2, -2048, 2047, 0, "12-bit işaretli ofset"},
+    [ENC_B]       = {FIELD_RS1 | FIELD_RS2, -4096, 4094, 1, "13-bit çift dallanma ofseti"},
+    [ENC_U]       = {FIELD_RD, 0, 0xFFFFF, 0, "20-bit üst sabit"},
+    [ENC_J]       = {FIELD_RD, -(1 << 20), (1 << 20) - 2, 1, "21-bit çift atlama ofseti"},
+    [ENC_FIXED]   = {0, INT32_MIN, INT32_MAX, 0, ""},
+};
+
+// Talimat tipi -> biçim ve sabit bitler (tabloda olmayan tipler ENC_NONE kalır)
+typedef struct {
+    uint8_t format;
+    uint32_t match;
+    const char *mnemonic;
+} EncodingEntry;
+
+static const EncodingEntry encoding_table[I_A_LABEL + 1] = {
+#define X(type, mnemonic, format, match) [type] = {format, match, mnemonic},
+    RISCV_ENCODING_TABLE(X)
+#undef X
+};
+
+/**
+ * @brief Sabiti biçimin bit konumlarına dağıtır.
+ */
+static inline uint32_t scatter_immediate(EncodingFormat format, uint32_t imm) {
+    switch (format) {
+        case ENC_I:
+            return (imm & 0xFFF) << 20;
+        case ENC_I_SHIFT:
+            return (imm & 0x1F) << 20;
+        case ENC_S:
+            return ((imm >> 5) & 0x7F) << 25 | (imm & 0x1F) << 7;
+        case ENC_B:
+            return ((imm >> 12) & 0x1) << 31 | ((imm >> 5) & 0x3F) << 25 |
+                   ((imm >> 1) & 0xF) << 8 | ((imm >> 11) & 0x1) << 7;
+        case ENC_U:
+            return (imm & 0xFFFFF) << 12;
+        case ENC_J:
+            return ((imm >> 20) & 0x1) << 31 | ((imm >> 1) & 0x3FF) << 21 |
+                   ((imm >> 11) & 0x1) << 20 | ((imm >> 12) & 0xFF) << 12;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Kodlanamayan talimatı rapor eder (derleme sonlanır). Sıcak döngünün dışında tutulur.
+ */
+static void report_encoding_error(const Instruction *inst, size_t index) {
+    char message[128];
+    if ((uint32_t)inst->type > I_A_LABEL || encoding_table[inst->type].format == ENC_NONE) {
+        snprintf(message, sizeof(message), "Talimat #%zu: tip %d sanal komut veya bilinmeyen bir talimat.", index, (int)inst->type);
+        report_error(ERR_CODEGEN_INVALID_INSTRUCTION, 0, message);
+    }
+
+    const EncodingEntry *entry = &encoding_table[inst->type];
+    const FormatRule *rule = &format_rules[entry->format];
+    if (((rule->fields & FIELD_RD) && !((uint32_t)inst->rd < R_COUNT)) ||
+        ((rule->fields & FIELD_RS1) && !((uint32_t)inst->rs1 < R_COUNT)) ||
+        ((rule->fields & FIELD_RS2) && !((uint32_t)inst->rs2 < R_COUNT))) {
+        snprintf(message, sizeof(message), "Talimat #%zu (%s): Fiziksel kayda atanmamış operant.", index, entry->mnemonic);
+        report_error(ERR_CODEGEN_INVALID_INSTRUCTION, 0, message);
+    }
+
+    snprintf(message, sizeof(message), "Talimat #%zu (%s): %d değeri %s alanına sığmıyor.",
+             index, entry->mnemonic, inst->immediate, rule->description);
+    report_error(ERR_CODEGEN_IMMEDIATE_RANGE, 0, message);
+}
+
+/**
+ * @brief Talimatı kodlar. Tüm geçerlilik kontrolleri tek bir nadiren alınan dala toplanır:
+ * Sabit aralığı işaretsiz tek karşılaştırmayla, kayıtlar alan maskesiyle denetlenir.
+ */
+static inline uint32_t encode(const Instruction *inst, size_t index) {
+    uint32_t type = (uint32_t)inst->type;
+    const EncodingEntry *entry = &encoding_table[type <= I_A_LABEL ? type : I_A_LABEL];
+    const FormatRule *rule = &format_rules[entry->format];
+    uint32_t imm = (uint32_t)inst->immediate;
+
+    uint32_t rd = rule->fields & FIELD_RD ? (uint32_t)inst->rd : 0;
+    uint32_t rs1 = rule->fields & FIELD_RS1 ? (uint32_t)inst->rs1 : 0;
+    uint32_t rs2 = rule->fields & FIELD_RS2 ? (uint32_t)inst->rs2 : 0;
+
+    bool invalid = entry->format == ENC_NONE ||
+                   imm - (uint32_t)rule->min > (uint32_t)rule->max - (uint32_t)rule->min ||
+                   (imm & (uint32_t)rule->align_mask) != 0 ||
+                   (rd | rs1 | rs2) >= R_COUNT;
+    if (invalid) report_encoding_error(inst, index);
+
+    return entry->match | rd << 7 | rs1 << 15 | rs2 << 20 | scatter_immediate((EncodingFormat)entry->format, imm);
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+uint32_t encoder_encode_instruction(const Instruction *inst) {
+    return encode(inst, 0);
+}
+
+void encoder_encode_buffer(const CodeBuffer *buffer, uint8_t *bytes) {
+    const Instruction *instructions = buffer->instructions;
+    for (size_t i = 0; i < buffer->count; i++, bytes += 4) {
+        uint32_t word = encode(&instructions[i], i);
+        bytes[0] = (uint8_t)word;
+        bytes[1] = (uint8_t)(word >> 8);
+        bytes[2] = (uint8_t)(word >> 16);
+        bytes[3] = (uint8_t)(word >> 24);
+    }
+}
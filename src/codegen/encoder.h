@@ -0,0 +1,111 @@
+#ifndef BESSAMBLY_ENCODER_H
+#define BESSAMBLY_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+
+// Ortak RV32IM Kodlayıcısı
+// UNIX ve Bare-Metal arka uçları aynı kodlayıcıyı kullanır; aralarındaki tek fark çıktının
+// nasıl yazıldığıdır. Her talimatın kodlaması aşağıdaki tek tablodan gelir: biçim (R/I/S/B/U/J)
+// ve talimata özgü sabit bitler (opcode, funct3, funct7). Atlama ofsetleri yerleşim geçişinde
+// (layout.c) çözülmüş olmalıdır; sanal komutlar (I_A_LABEL, I_A_CALL) kodlanamaz.
+
+// Talimat biçimleri
+// R: [funct7 | rs2 | rs1 | funct3 | rd | opcode]
+// I: [imm[11:0] | rs1 | funct3 | rd | opcode]  (kaydırmalar: imm[11:5] = funct7, imm[4:0] = shamt)
+// S: [imm[11:5] | rs2 | rs1 | funct3 | imm[4:0] | opcode]
+// B: [imm[12] | imm[10:5] | rs2 | rs1 | funct3 | imm[4:1] | imm[11] | opcode]
+// U: [imm[31:12] | rd | opcode]  (immediate üst 20 biti tutar)
+// J: [imm[20] | imm[10:1] | imm[11] | imm[19:12] | rd | opcode]
+typedef enum {
+    ENC_NONE = 0, // Kodlanamaz (sanal komut veya tabloda olmayan tip)
+    ENC_R,
+    ENC_I,
+    ENC_I_SHIFT,  // 5-bit kaydırma miktarlı I biçimi (SLLI/SRLI/SRAI)
+    ENC_S,
+    ENC_B,
+    ENC_U,
+    ENC_J,
+    ENC_FIXED,    // Operantsız, tamamen sabit kodlama (FENCE, ECALL, EBREAK)
+    ENC_FORMAT_COUNT
+} EncodingFormat;
+
+// Talimata özgü sabit bitler
+#define RV_MATCH(opcode, funct3, funct7) \
+    ((uint32_t)(opcode) | ((uint32_t)(funct3) << 12) | ((uint32_t)(funct7) << 25))
+
+// X(tip, ad, biçim, sabit bitler)
+#define RISCV_ENCODING_TABLE(X) \
+    /* RV32I: Kayıt-kayıt */ \
+    X(I_ADD,    "ADD",    ENC_R,       RV_MATCH(0x33, 0x0, 0x00)) \
+    X(I_SUB,    "SUB",    ENC_R,       RV_MATCH(0x33, 0x0, 0x20)) \
+    X(I_SLL,    "SLL",    ENC_R,       RV_MATCH(0x33, 0x1, 0x00)) \
+    X(I_SLT,    "SLT",    ENC_R,       RV_MATCH(0x33, 0x2, 0x00)) \
+    X(I_SLTU,   "SLTU",   ENC_R,       RV_MATCH(0x33, 0x3, 0x00)) \
+    X(I_XOR,    "XOR",    ENC_R,       RV_MATCH(0x33, 0x4, 0x00)) \
+    X(I_SRL,    "SRL",    ENC_R,       RV_MATCH(0x33, 0x5, 0x00)) \
+    X(I_SRA,    "SRA",    ENC_R,       RV_MATCH(0x33, 0x5, 0x20)) \
+    X(I_OR,     "OR",     ENC_R,       RV_MATCH(0x33, 0x6, 0x00)) \
+    X(I_AND,    "AND",    ENC_R,       RV_MATCH(0x33, 0x7, 0x00)) \
+    /* RV32M */ \
+    X(I_MUL,    "MUL",    ENC_R,       RV_MATCH(0x33, 0x0, 0x01)) \
+    X(I_MULH,   "MULH",   ENC_R,       RV_MATCH(0x33, 0x1, 0x01)) \
+    X(I_MULHSU, "MULHSU", ENC_R,       RV_MATCH(0x33, 0x2, 0x01)) \
+    X(I_MULHU,  "MULHU",  ENC_R,       RV_MATCH(0x33, 0x3, 0x01)) \
+    X(I_DIV,    "DIV",    ENC_R,       RV_MATCH(0x33, 0x4, 0x01)) \
+    X(I_DIVU,   "DIVU",   ENC_R,       RV_MATCH(0x33, 0x5, 0x01)) \
+    X(I_REM,    "REM",    ENC_R,       RV_MATCH(0x33, 0x6, 0x01)) \
+    X(I_REMU,   "REMU",   ENC_R,       RV_MATCH(0x33, 0x7, 0x01)) \
+    /* RV32I: Kayıt-sabit */ \
+    X(I_ADDI,   "ADDI",   ENC_I,       RV_MATCH(0x13, 0x0, 0x00)) \
+    X(I_SLTI,   "SLTI",   ENC_I,       RV_MATCH(0x13, 0x2, 0x00)) \
+    X(I_SLTIU,  "SLTIU",  ENC_I,       RV_MATCH(0x13, 0x3, 0x00)) \
+    X(I_XORI,   "XORI",   ENC_I,       RV_MATCH(0x13, 0x4, 0x00)) \
+    X(I_ORI,    "ORI",    ENC_I,       RV_MATCH(0x13, 0x6, 0x00)) \
+    X(I_ANDI,   "ANDI",   ENC_I,       RV_MATCH(0x13, 0x7, 0x00)) \
+    X(I_SLLI,   "SLLI",   ENC_I_SHIFT, RV_MATCH(0x13, 0x1, 0x00)) \
+    X(I_SRLI,   "SRLI",   ENC_I_SHIFT, RV_MATCH(0x13, 0x5, 0x00)) \
+    X(I_SRAI,   "SRAI",   ENC_I_SHIFT, RV_MATCH(0x13, 0x5, 0x20)) \
+    /* Yükleme/Depolama */ \
+    X(I_LB,     "LB",     ENC_I,       RV_MATCH(0x03, 0x0, 0x00)) \
+    X(I_LH,     "LH",     ENC_I,       RV_MATCH(0x03, 0x1, 0x00)) \
+    X(I_LW,     "LW",     ENC_I,       RV_MATCH(0x03, 0x2, 0x00)) \
+    X(I_LBU,    "LBU",    ENC_I,       RV_MATCH(0x03, 0x4, 0x00)) \
+    X(I_LHU,    "LHU",    ENC_I,       RV_MATCH(0x03, 0x5, 0x00)) \
+    X(I_SB,     "SB",     ENC_S,       RV_MATCH(0x23, 0x0, 0x00)) \
+    X(I_SH,     "SH",     ENC_S,       RV_MATCH(0x23, 0x1, 0x00)) \
+    X(I_SW,     "SW",     ENC_S,       RV_MATCH(0x23, 0x2, 0x00)) \
+    /* Dallanma/Atlama */ \
+    X(I_BEQ,    "BEQ",    ENC_B,       RV_MATCH(0x63, 0x0, 0x00)) \
+    X(I_BNE,    "BNE",    ENC_B,       RV_MATCH(0x63, 0x1, 0x00)) \
+    X(I_BLT,    "BLT",    ENC_B,       RV_MATCH(0x63, 0x4, 0x00)) \
+    X(I_BGE,    "BGE",    ENC_B,       RV_MATCH(0x63, 0x5, 0x00)) \
+    X(I_BLTU,   "BLTU",   ENC_B,       RV_MATCH(0x63, 0x6, 0x00)) \
+    X(I_BGEU,   "BGEU",   ENC_B,       RV_MATCH(0x63, 0x7, 0x00)) \
+    X(I_JAL,    "JAL",    ENC_J,       RV_MATCH(0x6F, 0x0, 0x00)) \
+    X(I_JALR,   "JALR",   ENC_I,       RV_MATCH(0x67, 0x0, 0x00)) \
+    /* Üst sabitler */ \
+    X(I_LUI,    "LUI",    ENC_U,       RV_MATCH(0x37, 0x0, 0x00)) \
+    X(I_AUIPC,  "AUIPC",  ENC_U,       RV_MATCH(0x17, 0x0, 0x00)) \
+    /* Sistem (HALT, EBREAK olarak kodlanır) */ \
+    X(I_FENCE,  "FENCE",  ENC_FIXED,   0x0FF0000F) \
+    X(I_ECALL,  "ECALL",  ENC_FIXED,   0x00000073) \
+    X(I_EBREAK, "EBREAK", ENC_FIXED,   0x00100073) \
+    X(I_A_HALT, "HALT",   ENC_FIXED,   0x00100073)
+
+/**
+ * @brief Tek bir talimatı 32-bit RISC-V makine koduna çevirir.
+ * Sabit/ofset biçimin alanına sığmıyorsa, kullanılan bir kayıt alanı hâlâ sanal kayıt tutuyorsa
+ * veya talimat kodlanamıyorsa hata raporlanır (derleme sonlanır).
+ */
+uint32_t encoder_encode_instruction(const Instruction *inst);
+
+/**
+ * @brief Yerleşimden geçmiş talimat arabelleğinin tamamını makine koduna çevirir.
+ * Kodlar, ana makinenin bayt sırasından bağımsız olarak küçük endian (little-endian) yazılır.
+ * @param bytes: En az buffer->count * 4 baytlık çıktı dizisi.
+ */
+void encoder_encode_buffer(const CodeBuffer *buffer, uint8_t *bytes);
+
+#endif // BESSAMBLY_ENCODER_H
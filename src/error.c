@@ -1,7 +1,17 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h> // Paralel ön uçta hata raporlamayı sıralamak için
 #include "error.h"
 
+// Birden fazla iş parçacığı aynı anda hata raporlarsa yalnızca ilki yazdırır ve
+// süreci sonlandırır; diğerleri kilitte bekler (exit() eşzamanlı çağrılmamalıdır).
+static pthread_mutex_t error_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// İş parçacığına özel hata yakalama durumu (bkz. error_capture_begin)
+static _Thread_local ErrorRecord *capture_record = NULL;
+static _Thread_local jmp_buf *capture_resume = NULL;
+
 // Hata kodlarına karşılık gelen kullanıcı dostu mesaj dizisi
 static const char *error_messages[] = {
     "Başarılı",
@@ -13,6 +23,10 @@ static const char *error_messages[] = {
     "Anlambilim Hatası: Aynı etiket birden fazla kez tanımlanmış.",
     "Anlambilim Hatası: Tanımlanmamış bir kayıt (register) kullanılıyor.",
     
+    "Kod Üretimi Hatası: Taşma (spill) alanı adres uzayına sığmıyor.",
+    "Kod Üretimi Hatası: Talimatın sabit değeri veya ofseti kodlama alanına sığmıyor.",
+    "Kod Üretimi Hatası: Talimat makine koduna çevrilemiyor.",
+    
     "Sistem Hatası: Kaynak dosya bulunamadı.",
     "Sistem Hatası: Bellek tahsisi başarısız (Out of Memory).",
     
@@ -25,8 +39,20 @@ void report_error(BESSAMBLY_ERROR error_code, int line_number, const char *messa
         error_code = ERR_COUNT; // 'Bilinmeyen Hata Kodu'nu kullan
     }
     
+    if (capture_record != NULL) {
+        // Mesaj çağıranın yığınında olabilir: Kopyalanır
+        capture_record->code = error_code;
+        capture_record->line_number = line_number;
+        snprintf(capture_record->message, sizeof(capture_record->message), "%s", message != NULL ? message : "");
+        jmp_buf *resume = capture_resume;
+        error_capture_end();
+        longjmp(*resume, 1);
+    }
+
     const char *error_desc = error_messages[error_code];
     
+    pthread_mutex_lock(&error_lock); // Bilinçli olarak serbest bırakılmaz (süreç sonlanır)
+    
     // Hata mesajını biçimlendir ve çıktı al
     if (line_number > 0) {
         fprintf(stderr, "\n[HATA] Satır %d: %s\n", line_number, error_desc);
@@ -41,4 +67,21 @@ void report_error(BESSAMBLY_ERROR error_code, int line_number, const char *messa
     
     // Derleyicinin çalışmasını sonlandır (Kritik Hata)
     exit(EXIT_FAILURE);
+}
+
+void error_capture_begin(ErrorRecord *record, jmp_buf *resume) {
+    record->code = ERR_NONE;
+    record->line_number = 0;
+    record->message[0] = '\0';
+    capture_record = record;
+    capture_resume = resume;
+}
+
+void error_capture_end(void) {
+    capture_record = NULL;
+    capture_resume = NULL;
+}
+
+void report_error_record(const ErrorRecord *record) {
+    report_error(record->code, record->line_number, record->message);
 }
\ No newline at end of file
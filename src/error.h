@@ -1,6 +1,8 @@
 #ifndef BESSAMBLY_ERROR_H
 #define BESSAMBLY_ERROR_H
 
+#include <setjmp.h> // Yakalanan hatalardan geri dönüş için
+
 // Bessambly Derleyicisi Hata Kodları
 typedef enum {
     ERR_NONE = 0,               // Hata Yok
@@ -12,6 +14,10 @@ typedef enum {
     ERR_SEMANTIC_DUPLICATE_LABEL, // Aynı Etiketin İki Kez Tanımlanması
     ERR_SEMANTIC_UNKNOWN_REGISTER, // Tanımlanmamış Kayıt Kullanımı (A, B, C...)
     
+    ERR_CODEGEN_SPILL_OVERFLOW, // Taşma (Spill) Alanı Adres Uzayının Sonunu Aşıyor
+    ERR_CODEGEN_IMMEDIATE_RANGE, // Talimat Sabiti/Ofseti Kodlama Alanına Sığmıyor
+    ERR_CODEGEN_INVALID_INSTRUCTION, // Kodlanamayan Talimat (sanal komut, sanal kayıt veya bilinmeyen tip)
+    
     ERR_FILE_NOT_FOUND,         // Kaynak Dosya Bulunamadı
     ERR_OUT_OF_MEMORY,          // Bellek Tahsisi Başarısız
     
@@ -27,4 +33,29 @@ typedef enum {
  */
 void report_error(BESSAMBLY_ERROR error_code, int line_number, const char *message);
 
+// Sonlandırmak yerine kaydedilen (yakalanan) hata
+typedef struct {
+    BESSAMBLY_ERROR code; // ERR_NONE: Hata yakalanmadı
+    int line_number;
+    char message[256];
+} ErrorRecord;
+
+/**
+ * @brief Çağıran iş parçacığında hata yakalamayı başlatır: Bundan sonraki ilk report_error çağrısı
+ * hatayı record'a yazar ve süreci sonlandırmak yerine resume'a longjmp ile döner.
+ * Paralel ön uç, hangi parçanın hatasının raporlanacağına tüm iş parçacıkları bittikten sonra karar
+ * vermek için kullanır (en küçük satır numaralı hata, seri ayrıştırmayla aynı).
+ */
+void error_capture_begin(ErrorRecord *record, jmp_buf *resume);
+
+/**
+ * @brief Çağıran iş parçacığında hata yakalamayı bitirir.
+ */
+void error_capture_end(void);
+
+/**
+ * @brief Yakalanmış bir hatayı raporlar ve derleme sürecini sonlandırır.
+ */
+void report_error_record(const ErrorRecord *record);
+
 #endif // BESSAMBLY_ERROR_H
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>  // sysconf için
+
+#include "frontend.h"
+#include "lexer.h"
+#include "lexer_scan.h"
+#include "parser.h"
+#include "error.h"
+#include "utils.h"
+
+#define FRONTEND_MIN_CHUNK_SIZE (256 * 1024) // Bundan küçük parçalar için iş parçacığı maliyeti ağır basar
+#define FRONTEND_CHUNKS_PER_JOB 4            // Yük dengeleme için iş parçacığı başına parça sayısı
+#define FRONTEND_MAX_JOBS 256
+
+// Satır sınırında başlayan ve biten kaynak kod parçası
+typedef struct {
+    const char *data;     // Parçanın başlangıcı (kaynak kod içinde)
+    size_t length;        // Parçanın uzunluğu ('\n' dahil)
+    size_t newline_count; // Parçadaki satır sonu sayısı (1. aşamada hesaplanır)
+    int first_line;       // Parçanın ilk satırının numarası (önek toplamla hesaplanır)
+    AST_Program *program; // Parçanın AST'si (2. aşamada üretilir, hata varsa NULL)
+    ErrorRecord error;    // Parçadaki ilk hata (program NULL ise)
+} FrontendChunk;
+
+typedef enum {
+    FRONTEND_PHASE_COUNT_LINES, // 1. Aşama: Satır sonlarını say
+    FRONTEND_PHASE_PARSE        // 2. Aşama: Lexer + Parser çalıştır
+} FrontendPhase;
+
+// İş parçacığı havuzunun paylaştığı iş kuyruğu
+typedef struct {
+    FrontendChunk *chunks;
+    size_t chunk_count;
+    atomic_size_t next_chunk; // Sıradaki işlenmemiş parçanın indeksi
+    FrontendPhase phase;
+} FrontendWork;
+
+// --- Yardımcı İşlevler ---
+
+/**
+ * @brief Verilen kaynak aralığını seri olarak belirteçlere ayırır ve ayrıştırır.
+ */
+static AST_Program *parse_range(const char *data, size_t length, int first_line) {
+    Lexer *lexer = lexer_init(data, length);
+    lexer->current_line = first_line;
+
+    Parser *parser = parser_init(lexer);
+    AST_Program *program = parser_parse_program(parser);
+
+    parser_free(parser);
+    lexer_free(lexer);
+    return program;
+}
+
+/**
+ * @brief Bir parçayı ayrıştırır; ilk hatada süreci sonlandırmak yerine hatayı parçaya kaydeder ve
+ * NULL döndürür. Hangi hatanın raporlanacağına tüm parçalar bittikten sonra karar verilir: Aksi
+ * halde raporlanan hata, en erken satırdaki değil ilk biten iş parçacığınınki olurdu.
+ */
+static AST_Program *parse_chunk(FrontendChunk *chunk) {
+    jmp_buf resume;
+    if (setjmp(resume) != 0) {
+        // Yarım kalan lexer/parser/AST serbest bırakılmaz: Hata raporlanıp süreç sonlanacak
+        return NULL;
+    }
+    error_capture_begin(&chunk->error, &resume);
+    AST_Program *program = parse_range(chunk->data, chunk->length, chunk->first_line);
+    error_capture_end();
+    return program;
+}
+
+/**
+ * @brief Havuzdaki her iş parçacığının çalıştırdığı döngü: kuyruktan parça alır ve işler.
+ */
+static void *frontend_worker(void *arg) {
+    FrontendWork *work = (FrontendWork *)arg;
+
+    while (1) {
+        size_t index = atomic_fetch_add(&work->next_chunk, 1);
+        if (index >= work->chunk_count) break;
+
+        FrontendChunk *chunk = &work->chunks[index];
+        if (work->phase == FRONTEND_PHASE_COUNT_LINES) {
+            chunk->newline_count = lexer_scan_count_newlines(chunk->data, chunk->length);
+        } else {
+            chunk->program = parse_chunk(chunk);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bir aşamayı iş parçacığı havuzunda çalıştırır (çağıran iş parçacığı da çalışır).
+ */
+static void frontend_run_phase(FrontendWork *work, FrontendPhase phase, int jobs) {
+    pthread_t threads[FRONTEND_MAX_JOBS];
+    int started = 0;
+
+    work->phase = phase;
+    atomic_store(&work->next_chunk, 0);
+
+    for (int i = 1; i < jobs; i++) {
+        if (pthread_create(&threads[started], NULL, frontend_worker, work) != 0) {
+            break; // Kalan işi mevcut iş parçacıkları üstlenir
+        }
+        started++;
+    }
+
+    frontend_worker(work);
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+/**
+ * @brief Kaynağı yaklaşık eşit boyutlu, satır sınırında biten parçalara böler.
+ * @return size_t: Oluşturulan parça sayısı.
+ */
+static size_t frontend_split(const char *source, size_t length, size_t target_count, FrontendChunk *chunks) {
+    size_t target_size = length / target_count;
+    size_t count = 0;
+    size_t pos = 0;
+
+    while (pos < length) {
+        size_t end = pos + target_size;
+        if (count == target_count - 1 || end >= length) {
+            end = length;
+        } else {
+            // Parçayı bir sonraki '\n' karakterinden hemen sonra bitir
+            end = lexer_scan_find_newline(source, end, length);
+            if (end < length) end++;
+        }
+
+        chunks[count].data = source + pos;
+        chunks[count].length = end - pos;
+        chunks[count].newline_count = 0;
+        chunks[count].first_line = 1;
+        chunks[count].program = NULL;
+        count++;
+        pos = end;
+    }
+    return count;
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+AST_Program *frontend_parse(const char *source, size_t length, int jobs) {
+    if (jobs <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = cpus > 0 ? (int)cpus : 1;
+    }
+    if (jobs > FRONTEND_MAX_JOBS) {
+        jobs = FRONTEND_MAX_JOBS;
+    }
+
+    size_t chunk_count = (size_t)jobs * FRONTEND_CHUNKS_PER_JOB;
+    if (chunk_count > length / FRONTEND_MIN_CHUNK_SIZE) {
+        chunk_count = length / FRONTEND_MIN_CHUNK_SIZE;
+    }
+
+    // Küçük girişler veya -j 1: seri ayrıştırma
+    if (jobs == 1 || chunk_count <= 1) {
+        return parse_range(source, length, 1);
+    }
+
+    lexer_scan_init(); // Tarama uygulamasını iş parçacıkları başlamadan seç
+
+    FrontendWork work;
+    work.chunks = (FrontendChunk *)safe_malloc(chunk_count * sizeof(FrontendChunk));
+    work.chunk_count = frontend_split(source, length, chunk_count, work.chunks);
+
+    printf("Paralel Ön Uç: %zu parça, %d iş parçacığı.\n", work.chunk_count, jobs);
+
+    // 1. Aşama: Her parçanın satır sayısını paralel olarak bul, ardından
+    // önek toplamla (prefix sum) her parçanın ilk satır numarasını hesapla.
+    frontend_run_phase(&work, FRONTEND_PHASE_COUNT_LINES, jobs);
+
+    int line = 1;
+    for (size_t i = 0; i < work.chunk_count; i++) {
+        work.chunks[i].first_line = line;
+        line += (int)work.chunks[i].newline_count;
+    }
+
+    // 2. Aşama: Her parçayı bağımsız olarak ayrıştır
+    frontend_run_phase(&work, FRONTEND_PHASE_PARSE, jobs);
+
+    // Hatalı parçalardan en küçük indeksli olanın (kaynakta en erken) hatası raporlanır; -j 1 ile aynı
+    for (size_t i = 0; i < work.chunk_count; i++) {
+        if (work.chunks[i].program == NULL) report_error_record(&work.chunks[i].error);
+    }
+
+    // Parça AST'lerini kaynak sırasıyla birleştir (komut tablosu tek seferde ayrılır)
+    size_t total = 0;
+    for (size_t i = 0; i < work.chunk_count; i++) {
+        total += work.chunks[i].program->statement_count;
+    }
+
+    AST_Program *program = ast_program_create();
+    ast_program_reserve(program, (AST_StmtIndex)total);
+    for (size_t i = 0; i < work.chunk_count; i++) {
+        ast_program_splice(program, work.chunks[i].program);
+        ast_program_free(work.chunks[i].program);
+    }
+
+    free(work.chunks);
+    return program;
+}
@@ -0,0 +1,21 @@
+#ifndef BESSAMBLY_FRONTEND_H
+#define BESSAMBLY_FRONTEND_H
+
+#include <stddef.h>
+#include "ast.h"
+
+/**
+ * @brief Kaynak kodu belirteçlere ayırır ve ayrıştırarak AST oluşturur (Lexer + Parser).
+ * * Bessambly satır yönelimli olduğundan (her komut TOKEN_NEWLINE ile biter ve iç içe yapı yoktur),
+ * büyük girişler satır sınırlarından parçalara bölünebilir. jobs > 1 ise parçalar bir iş parçacığı
+ * havuzunda bağımsız olarak ayrıştırılır ve ortaya çıkan komut listeleri kaynak sırasıyla birleştirilir.
+ * Satır numaraları her parça için önceden hesaplandığından hata mesajları ve AST aynı kalır; birden
+ * fazla parçada hata varsa kaynakta en erken olan raporlanır.
+ * * @param source: Kaynak kod (NULL ile sonlandırılmış olması gerekmez).
+ * @param length: Kaynak kodun uzunluğu.
+ * @param jobs: Kullanılacak iş parçacığı sayısı (0: çevrimiçi CPU sayısı, 1: seri ayrıştırma).
+ * @return AST_Program*: Oluşturulan AST, başarısız olursa NULL.
+ */
+AST_Program *frontend_parse(const char *source, size_t length, int jobs);
+
+#endif // BESSAMBLY_FRONTEND_H
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "interner.h"
+#include "utils.h" // safe_malloc/safe_realloc için
+
+#define INTERNER_INITIAL_CAPACITY 256 // İlk kimlik kapasitesi
+#define INTERNER_INITIAL_SLOTS    512 // İlk yuva sayısı (2'nin kuvveti)
+
+// --- Yardımcı İşlevler ---
+
+/**
+ * @brief FNV-1a 32-bit özet işlevi.
+ */
+static uint32_t interner_hash(const char *text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Yuva tablosunu verilen boyutta yeniden kurar (doluluk oranı 1/2'nin altında tutulur).
+ */
+static void interner_rehash(Interner *interner, uint32_t slot_count) {
+    free(interner->slots);
+    interner->slots = (SymbolId *)safe_malloc(slot_count * sizeof(SymbolId));
+    memset(interner->slots, 0, slot_count * sizeof(SymbolId));
+    interner->slot_mask = slot_count - 1;
+
+    for (SymbolId id = 1; id <= interner->count; id++) {
+        uint32_t slot = interner->hashes[id] & interner->slot_mask;
+        while (interner->slots[slot] != SYMBOL_ID_NONE) {
+            slot = (slot + 1) & interner->slot_mask; // Doğrusal yoklama
+        }
+        interner->slots[slot] = id;
+    }
+}
+
+/**
+ * @brief İsmin yuvasını bulur: ismin kimliğini içeren yuva veya eklenecek boş yuva.
+ */
+static uint32_t interner_probe(const Interner *interner, const char *text, size_t length, uint32_t hash) {
+    uint32_t slot = hash & interner->slot_mask;
+    while (1) {
+        SymbolId id = interner->slots[slot];
+        if (id == SYMBOL_ID_NONE) {
+            return slot;
+        }
+        if (interner->hashes[id] == hash && interner->lengths[id] == length &&
+            memcmp(interner->names[id], text, length) == 0) {
+            return slot;
+        }
+        slot = (slot + 1) & interner->slot_mask;
+    }
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+void interner_init(Interner *interner) {
+    interner->names = NULL;
+    interner->lengths = NULL;
+    interner->hashes = NULL;
+    interner->count = 0;
+    interner->capacity = 0;
+    interner->slots = NULL;
+    interner->slot_mask = 0;
+    arena_init(&interner->arena);
+    interner_rehash(interner, INTERNER_INITIAL_SLOTS);
+}
+
+SymbolId interner_intern(Interner *interner, const char *text, size_t length) {
+    uint32_t hash = interner_hash(text, length);
+    uint32_t slot = interner_probe(interner, text, length, hash);
+    if (interner->slots[slot] != SYMBOL_ID_NONE) {
+        return interner->slots[slot]; // İsim zaten havuzda
+    }
+
+    // Kimlik dizilerini büyüt (0. kimlik ayrılmıştır)
+    SymbolId id = interner->count + 1;
+    if (id >= interner->capacity) {
+        uint32_t capacity = interner->capacity ? interner->capacity * 2 : INTERNER_INITIAL_CAPACITY;
+        interner->names = (const char **)safe_realloc((void *)interner->names, capacity * sizeof(const char *));
+        interner->lengths = (uint32_t *)safe_realloc(interner->lengths, capacity * sizeof(uint32_t));
+        interner->hashes = (uint32_t *)safe_realloc(interner->hashes, capacity * sizeof(uint32_t));
+        interner->capacity = capacity;
+    }
+
+    interner->names[id] = arena_strndup(&interner->arena, text, length);
+    interner->lengths[id] = (uint32_t)length;
+    interner->hashes[id] = hash;
+    interner->count = id;
+    interner->slots[slot] = id;
+
+    // Doluluk oranı 1/2'yi geçerse yuva tablosunu iki katına çıkar
+    if ((size_t)interner->count * 2 > (size_t)interner->slot_mask + 1) {
+        interner_rehash(interner, (interner->slot_mask + 1) * 2);
+    }
+    return id;
+}
+
+SymbolId interner_find(const Interner *interner, const char *text, size_t length) {
+    uint32_t hash = interner_hash(text, length);
+    return interner->slots[interner_probe(interner, text, length, hash)];
+}
+
+size_t interner_footprint(const Interner *interner) {
+    return (size_t)interner->capacity * (sizeof(const char *) + 2 * sizeof(uint32_t)) +
+           ((size_t)interner->slot_mask + 1) * sizeof(SymbolId) +
+           interner->arena.reserved_bytes;
+}
+
+void interner_free(Interner *interner) {
+    free((void *)interner->names);
+    free(interner->lengths);
+    free(interner->hashes);
+    free(interner->slots);
+    arena_release(&interner->arena);
+    interner->names = NULL;
+    interner->lengths = NULL;
+    interner->hashes = NULL;
+    interner->slots = NULL;
+    interner->count = 0;
+    interner->capacity = 0;
+}
@@ -0,0 +1,83 @@
+#ifndef BESSAMBLY_INTERNER_H
+#define BESSAMBLY_INTERNER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h" // İsim metinlerinin tahsisi için
+
+// İsim Havuzu (String Interner)
+// Kayıt ve etiket isimlerinin her biri bir kez saklanır ve yoğun (dense) bir 32-bit
+// kimlik (SymbolId) alır. Derleyicinin geri kalanı isimleri kimlikle taşır ve
+// karşılaştırır; metin yalnızca hata mesajları ve debug çıktısı için geri alınır.
+// İsim uzunluğu sınırı yoktur.
+
+typedef uint32_t SymbolId;
+
+// Geçersiz/boş kimlik. Kimlikler 1'den başlar; böylece sıfırla başlatılmış
+// yapılar (örn: etiketsiz talimatlar) hiçbir ismi göstermez.
+#define SYMBOL_ID_NONE 0
+
+typedef struct {
+    const char **names; // Kimlik -> NULL ile sonlandırılmış isim (arenada)
+    uint32_t *lengths;  // Kimlik -> isim uzunluğu
+    uint32_t *hashes;   // Kimlik -> isim özeti (yeniden özetlemede kullanılır)
+    uint32_t count;     // Verilen en büyük kimlik (kimlik sayısı)
+    uint32_t capacity;  // Kimlik dizilerinin kapasitesi
+
+    SymbolId *slots;    // Açık adresli özet tablosu (SYMBOL_ID_NONE: boş yuva)
+    uint32_t slot_mask; // Yuva sayısı - 1 (yuva sayısı 2'nin kuvvetidir)
+
+    Arena arena;        // İsim metinlerinin tutulduğu bölge
+} Interner;
+
+/**
+ * @brief Boş bir isim havuzunu başlatır.
+ */
+void interner_init(Interner *interner);
+
+/**
+ * @brief İsmi havuza ekler; isim zaten varsa mevcut kimliği döndürür.
+ * @param text: İsim metni (NULL ile sonlandırılmış olması gerekmez).
+ * @param length: İsim uzunluğu (bayt).
+ * @return SymbolId: İsmin kimliği.
+ */
+SymbolId interner_intern(Interner *interner, const char *text, size_t length);
+
+/**
+ * @brief İsmi havuzda arar, eklemez.
+ * @return SymbolId: İsmin kimliği, bulunamazsa SYMBOL_ID_NONE.
+ */
+SymbolId interner_find(const Interner *interner, const char *text, size_t length);
+
+/**
+ * @brief Kimliğin ismini döndürür (havuz serbest bırakılana kadar geçerlidir).
+ */
+static inline const char *interner_name(const Interner *interner, SymbolId id) {
+    return interner->names[id];
+}
+
+/**
+ * @brief Kimliğin isim uzunluğunu döndürür.
+ */
+static inline uint32_t interner_length(const Interner *interner, SymbolId id) {
+    return interner->lengths[id];
+}
+
+/**
+ * @brief Havuzdaki isim sayısını döndürür (kimlikler 1..count aralığındadır).
+ */
+static inline uint32_t interner_count(const Interner *interner) {
+    return interner->count;
+}
+
+/**
+ * @brief Havuzun kullandığı belleği bayt cinsinden döndürür.
+ */
+size_t interner_footprint(const Interner *interner);
+
+/**
+ * @brief Havuzun tüm belleğini serbest bırakır.
+ */
+void interner_free(Interner *interner);
+
+#endif // BESSAMBLY_INTERNER_H
@@ -2,28 +2,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include "ir_generator.h"
+#include "isel.h"
 #include "error.h"
 #include "utils.h"
 
 #define INITIAL_CAPACITY 64 // Kod arabelleği başlangıç boyutu
 
-// --- Yardımcı İşlevler: Kayıt Ataması ve Buffer Yönetimi ---
+// --- Buffer Yönetimi ---
 
-// Bessambly'de sadece basit tek harfli kayıtlar (A, B, C...) olduğunu varsayarsak,
-// bunları RISC-V S-Type (Saved) kayıtlara eşleştirelim.
-// Örneğin: A -> R_S1, B -> R_S2, C -> R_S3
-static Register get_register_from_name(const char *name) {
-    if (name[0] >= 'A' && name[0] <= 'Z' && name[1] == '\0') {
-        // Basit tek harfli kayıt eşleştirmesi: A->S1, B->S2, C->S3...
-        // S0 genellikle program akışı için ayrılır. S1'den başlatalım.
-        return (Register)(R_S1 + (name[0] - 'A')); 
-    }
-    // Daha karmaşık kayıt isimleri için şimdilik R_T0 döndürüyoruz (Hata durumu veya geçici kullanım)
-    return R_T0; 
-}
-
-
-static void buffer_append_instruction(CodeBuffer *buffer, Instruction inst) {
+void code_buffer_append(CodeBuffer *buffer, Instruction inst) {
     if (buffer->count >= buffer->capacity) {
         buffer->capacity *= 2;
         buffer->instructions = (Instruction *)safe_realloc(
@@ -36,103 +23,57 @@ static void buffer_append_instruction(CodeBuffer *buffer, Instruction inst) {
 
 
 // --- AST Düğümlerinden RISC-V Talimatları Üretme ---
+// Atama ve koşullu atlama komutlarının talimatları komut seçici (isel.c) tarafından seçilir.
 
 /**
- * @brief Tek bir AST operantını RISC-V talimatlarına çevirir. 
- * Sonucu hedef kayda (dest_reg) yükler.
- * @param opr: İşlenecek AST operantı.
- * @param dest_reg: Operantın değerinin yükleneceği kayıt.
- * @param buffer: Kod arabelleği.
+ * @brief Tek bir AST komutunun talimatlarını arabelleğe üretir.
+ * Etiketler ve atlamalar temel blok sınırıdır; komut seçicinin sabit önbelleği sıfırlanır.
  */
-static void generate_operand_load(AST_Operand *opr, Register dest_reg, CodeBuffer *buffer) {
-    if (opr->type == OPR_TYPE_REGISTER) {
-        Register src_reg = get_register_from_name(opr->name);
-        // Kaydı kopyala (Dest = Src + 0)
-        buffer_append_instruction(buffer, (Instruction){I_ADD, dest_reg, src_reg, R_ZERO, 0});
-        
-    } else if (opr->type == OPR_TYPE_IMMEDIATE_INT) {
-        // Sabit değeri yükle (Dest = ZERO + Sabit)
-        // ADDI rd, x0, imm (imm 12-bit ile sinirli)
-        // Simdilik 12-bit sinirlarini goz ardi ediyoruz, ILERI: LUI/ADDI kullanilmalidir
-        buffer_append_instruction(buffer, (Instruction){I_ADDI, dest_reg, R_ZERO, 0, (int32_t)opr->value});
-        
-    } else if (opr->type == OPR_TYPE_MEMORY_ADDR) {
-        // Bellekten yükle (LW rd, offset(rs1))
-        // Burada rs1 olarak R_ZERO kullanilmistir. Bellek adresi doğrudan offset olarak kullanilir.
-        // ILERI: Global pointer (R_GP) veya stack pointer (R_SP) ile adresleme kullanilmalidir.
-        buffer_append_instruction(buffer, (Instruction){I_LW, dest_reg, R_ZERO, 0, (int32_t)opr->mem_address});
+static void generate_statement(IselContext *isel, const AST_Program *program, AST_StmtIndex index, CodeBuffer *buffer) {
+    switch (ast_stmt_type(program, index)) {
+        case STMT_TYPE_LABEL_DEF:
+            // Etiket makine kodu üretmez; konumu yerleşim geçişinde bayt adresine çevrilir.
+            isel_end_block(isel);
+            code_buffer_append(buffer, (Instruction){I_A_LABEL, R_ZERO, R_ZERO, R_ZERO, 0, ast_stmt_label(program, index)});
+            break;
+        case STMT_TYPE_ASSIGNMENT:
+            isel_assignment(isel, program, index, buffer);
+            break;
+        case STMT_TYPE_GOTO:
+            // JAL x0, hedef (uzak hedefler için yerleşim geçişi AUIPC+JALR'a genişletir)
+            code_buffer_append(buffer, (Instruction){I_JAL, R_ZERO, R_ZERO, R_ZERO, 0, ast_stmt_label(program, index)});
+            isel_end_block(isel);
+            break;
+        case STMT_TYPE_IF_GOTO:
+            isel_if_goto(isel, program, index, buffer);
+            isel_end_block(isel);
+            break;
     }
 }
 
+// --- İleri Başvuru Düzeltme Listesi (Tek Geçişli Mod) ---
 
-/**
- * @brief İkili ifadeyi (A+B) RISC-V talimatlarına çevirir.
- * Sonucu rs1 kaydına atar.
- */
-static void generate_binary_expr(AST_Expr *expr, Register rs1, CodeBuffer *buffer) {
-    // 1. Sol operantı geçici T0 kaydına yükle
-    generate_operand_load(&expr->data.binary_op.left, R_T0, buffer);
-    
-    // 2. Sağ operantı geçici T1 kaydına yükle
-    generate_operand_load(&expr->data.binary_op.right, R_T1, buffer);
-    
-    // 3. İşlemi yap ve sonucu rs1'e kaydet (rs1 = T0 OP T1)
-    InstructionType inst_type = I_ADD; 
-    switch (expr->data.binary_op.op) {
-        case OP_BIN_ADD: inst_type = I_ADD; break;
-        case OP_BIN_SUB: inst_type = I_SUB; break;
-        // Basitlik icin sadece ADD/SUB kullanilmistir. ILERI: MUL/DIV/AND/OR eklenmelidir.
-        default: inst_type = I_ADD; break; 
-    }
-    
-    buffer_append_instruction(buffer, (Instruction){inst_type, rs1, R_T0, R_T1, 0});
-}
-
+// Hedef etiketi henüz tanımlanmamış bir atlama. Geçiş sonunda yalnızca hedefin tanımlandığı
+// doğrulanır; atlama talimatı etiket kimliğini taşıdığından hedef adresi yerleşim geçişinde çözülür.
+typedef struct {
+    SymbolId label; // Hedef etiket
+    int line;       // Atlamanın kaynak satırı (hata raporu için)
+} IRFixup;
 
-static void generate_assignment(AST_Node *node, CodeBuffer *buffer) {
-    // Hedef kayıt (Destination Register)
-    Register dest_reg;
-    bool is_mem_store = false;
-    
-    if (node->data.assignment.destination.type == OPR_TYPE_REGISTER) {
-        dest_reg = get_register_from_name(node->data.assignment.destination.name);
-    } else if (node->data.assignment.destination.type == OPR_TYPE_MEMORY_ADDR) {
-        // Belleğe yazılacaksa, sonuç geçici bir kayda (R_T0) hesaplanmalı
-        dest_reg = R_T0; 
-        is_mem_store = true;
-    } else {
-        // Bu durum anlambilim analizinde yakalanmış olmalı (Sabit hedefe atama)
-        return; 
-    }
+typedef struct {
+    IRFixup *items;
+    size_t count;
+    size_t capacity;
+} IRFixupList;
 
-    // İfadeyi hesapla
-    if (node->data.assignment.expression.type == EXPR_TYPE_OPERAND) {
-        // Sadece tek bir operant atanıyor (A = B veya A = 10)
-        generate_operand_load(&node->data.assignment.expression.data.operand, dest_reg, buffer);
-    } else {
-        // İkili ifade atanıyor (C = A + B)
-        generate_binary_expr(&node->data.assignment.expression, dest_reg, buffer);
-    }
-    
-    // Bellek Depolama İşlemi (MEM[addr] = expr)
-    if (is_mem_store) {
-        // SW rs2, offset(rs1)
-        // rs2: Hesaplanan değer (R_T0)
-        // offset: Bellek adresi
-        buffer_append_instruction(buffer, 
-            (Instruction){
-                I_SW, 
-                R_ZERO, // rd kullanılmaz
-                R_ZERO, // rs1 (Temel adres: 0x0)
-                dest_reg, // rs2 (Kaynak Kayıt - Hesaplanan değer)
-                (int32_t)node->data.assignment.destination.mem_address
-            }
-        );
+static void fixup_list_append(IRFixupList *list, IRFixup fixup) {
+    if (list->count >= list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : INITIAL_CAPACITY;
+        list->items = (IRFixup *)safe_realloc(list->items, list->capacity * sizeof(IRFixup));
     }
+    list->items[list->count++] = fixup;
 }
 
-// ILERI: GOTO ve IF_GOTO talimat uretimi eklenmelidir.
-
 // --- Genel İşlev Uygulamaları ---
 
 CodeBuffer *code_buffer_init() {
@@ -140,40 +81,72 @@ CodeBuffer *code_buffer_init() {
     buffer->instructions = (Instruction *)safe_malloc(INITIAL_CAPACITY * sizeof(Instruction));
     buffer->count = 0;
     buffer->capacity = INITIAL_CAPACITY;
+    buffer->spill_base = 0;
     return buffer;
 }
 
-CodeBuffer *generate_riscv_code(AST_Program *program, SymbolTable *sym_table) {
+CodeBuffer *generate_riscv_code(AST_Program *program, SymbolTable *sym_table, TargetIsa isa) {
     printf("RISC-V Kod Üretimi Başladı...\n");
     CodeBuffer *buffer = code_buffer_init();
+    IselContext isel;
+    isel_init(&isel, program, isa, buffer);
     
     // AST'yi dolaş
-    AST_Node *current = program->first_statement;
-    while (current != NULL) {
-        switch (current->type) {
-            case STMT_TYPE_LABEL_DEF:
-                // Etiketler sadece Sembol Tablosunda adreslenir, makine kodu üretmez.
-                break;
-            case STMT_TYPE_ASSIGNMENT:
-                generate_assignment(current, buffer);
-                break;
-            case STMT_TYPE_GOTO:
-                // ILERI: GOTO komutu (JAL veya B-Type) üretilmelidir.
-                break;
-            case STMT_TYPE_IF_GOTO:
-                // ILERI: IF_GOTO komutu (B-Type) üretilmelidir.
-                break;
-        }
-        current = current->next;
+    for (AST_StmtIndex i = 0; i < program->statement_count; i++) {
+        generate_statement(&isel, program, i, buffer);
     }
     
-    // Program sonuna HALT komutu ekle
-    buffer_append_instruction(buffer, (Instruction){I_A_HALT, R_ZERO, R_ZERO, R_ZERO, 0});
+    // Program sonuna HALT komutu ekle; çağrılan yardımcı rutinler ondan sonra gelir
+    code_buffer_append(buffer, (Instruction){I_A_HALT, R_ZERO, R_ZERO, R_ZERO, 0, SYMBOL_ID_NONE});
+    isel_finish(&isel, buffer);
     
     printf("RISC-V Kod Üretimi Başarılı. Toplam %zu talimat üretildi.\n", buffer->count);
     return buffer;
 }
 
+CodeBuffer *generate_riscv_code_single_pass(AST_Program *program, SymbolTable *sym_table, TargetIsa isa) {
+    printf("Tek Geçişli Anlambilim Analizi ve Kod Üretimi Başladı...\n");
+    CodeBuffer *buffer = code_buffer_init();
+    IRFixupList fixups = {0};
+    IselContext isel;
+    isel_init(&isel, program, isa, buffer);
+    
+    for (AST_StmtIndex i = 0; i < program->statement_count; i++) {
+        StatementType type = ast_stmt_type(program, i);
+        
+        if (type == STMT_TYPE_LABEL_DEF) {
+            // Etiketi topla (geçici adres: komut indeksi; kesin adres yerleşim geçişinde atanır)
+            SymbolId label = ast_stmt_label(program, i);
+            if (!symtable_add(sym_table, label, SYM_TYPE_LABEL, (long long)i)) {
+                report_error(ERR_SEMANTIC_DUPLICATE_LABEL, ast_stmt_line(program, i), ast_name(program, label));
+            }
+        } else if (type == STMT_TYPE_GOTO || type == STMT_TYPE_IF_GOTO) {
+            // Geriye başvurular hemen doğrulanır, ileri başvurular listeye eklenir
+            SymbolId target = ast_stmt_label(program, i);
+            if (symtable_lookup(sym_table, target) == NULL) {
+                fixup_list_append(&fixups, (IRFixup){target, ast_stmt_line(program, i)});
+            }
+        }
+        
+        generate_statement(&isel, program, i, buffer);
+    }
+    
+    // Geçiş bittiğinde ileri başvuruları çöz; tanımsız kalan etiketler hata olarak raporlanır
+    for (size_t f = 0; f < fixups.count; f++) {
+        const Symbol *target_sym = symtable_lookup(sym_table, fixups.items[f].label);
+        if (target_sym == NULL || target_sym->type != SYM_TYPE_LABEL) {
+            report_error(ERR_SEMANTIC_UNKNOWN_LABEL, fixups.items[f].line, ast_name(program, fixups.items[f].label));
+        }
+    }
+    free(fixups.items);
+    
+    code_buffer_append(buffer, (Instruction){I_A_HALT, R_ZERO, R_ZERO, R_ZERO, 0, SYMBOL_ID_NONE});
+    isel_finish(&isel, buffer);
+    
+    printf("Tek Geçişli Kod Üretimi Başarılı. Toplam %zu talimat üretildi.\n", buffer->count);
+    return buffer;
+}
+
 void code_buffer_free(CodeBuffer *buffer) {
     if (buffer != NULL) {
         free(buffer->instructions);
@@ -183,15 +156,24 @@ void code_buffer_free(CodeBuffer *buffer) {
 
 // --- DEBUG Fonksiyonu ---
 static const char *get_reg_name(Register r) {
+    // Not: Tek bir printf çağrısında en fazla 3 kayıt adı kullanıldığından dönüşümlü arabellek yeterlidir.
+    static char names[3][16];
+    static int next = 0;
+    char *name = names[next];
+    next = (next + 1) % 3;
+    
     if (r == R_ZERO) return "x0/zero";
     if (r == R_SP) return "x2/sp";
-    if (r >= R_T0 && r <= R_T2) {
-        static char name[5]; sprintf(name, "t%d", r - R_T0); return name;
-    }
-    if (r >= R_S0 && r <= R_S3) {
-        static char name[5]; sprintf(name, "s%d", r - R_S0); return name;
+    if (REGISTER_IS_VIRTUAL(r)) {
+        sprintf(name, "v%d", r - R_VIRTUAL_BASE); // Atanmamış sanal kayıt
+    } else if (r >= R_T0 && r <= R_T2) {
+        sprintf(name, "t%d", r - R_T0);
+    } else if (r >= R_T3 && r <= R_T6) {
+        sprintf(name, "t%d", r - R_T3 + 3);
+    } else {
+        sprintf(name, "x%d", r);
     }
-    return "x??";
+    return name;
 }
 
 void print_riscv_code(CodeBuffer *buffer) {
@@ -210,15 +192,71 @@ void print_riscv_code(CodeBuffer *buffer) {
             case I_SUB: 
                 printf("SUB %s, %s, %s\n", get_reg_name(inst->rd), get_reg_name(inst->rs1), get_reg_name(inst->rs2)); 
                 break;
-            case I_LW: 
-                printf("LW %s, %d(%s)\n", get_reg_name(inst->rd), inst->immediate, get_reg_name(inst->rs1)); 
+            case I_AND: case I_OR: case I_XOR: case I_SLL: case I_SRL: case I_SRA: case I_SLT: case I_SLTU:
+            case I_MUL: case I_MULH: case I_MULHSU: case I_MULHU: case I_DIV: case I_DIVU: case I_REM: case I_REMU: {
+                static const char *names[] = { [I_AND] = "AND", [I_OR] = "OR", [I_XOR] = "XOR", [I_SLL] = "SLL",
+                                               [I_SRL] = "SRL", [I_SRA] = "SRA", [I_SLT] = "SLT", [I_SLTU] = "SLTU",
+                                               [I_MUL] = "MUL", [I_MULH] = "MULH", [I_MULHSU] = "MULHSU", [I_MULHU] = "MULHU",
+                                               [I_DIV] = "DIV", [I_DIVU] = "DIVU", [I_REM] = "REM", [I_REMU] = "REMU" };
+                printf("%s %s, %s, %s\n", names[inst->type], get_reg_name(inst->rd), get_reg_name(inst->rs1), get_reg_name(inst->rs2));
+                break;
+            }
+            case I_ANDI: case I_ORI: case I_XORI: case I_SLTI: case I_SLTIU: case I_SLLI: case I_SRLI: case I_SRAI: {
+                static const char *names[] = { [I_ANDI] = "ANDI", [I_ORI] = "ORI", [I_XORI] = "XORI", [I_SLTI] = "SLTI",
+                                               [I_SLTIU] = "SLTIU", [I_SLLI] = "SLLI", [I_SRLI] = "SRLI", [I_SRAI] = "SRAI" };
+                printf("%s %s, %s, %d\n", names[inst->type], get_reg_name(inst->rd), get_reg_name(inst->rs1), inst->immediate);
+                break;
+            }
+            case I_LW: case I_LH: case I_LHU: case I_LB: case I_LBU: {
+                static const char *names[] = { [I_LW] = "LW", [I_LH] = "LH", [I_LHU] = "LHU", [I_LB] = "LB", [I_LBU] = "LBU" };
+                printf("%s %s, %d(%s)\n", names[inst->type], get_reg_name(inst->rd), inst->immediate, get_reg_name(inst->rs1));
+                break;
+            }
+            case I_SW: case I_SH: case I_SB: {
+                static const char *names[] = { [I_SW] = "SW", [I_SH] = "SH", [I_SB] = "SB" };
+                printf("%s %s, %d(%s)\n", names[inst->type], get_reg_name(inst->rs2), inst->immediate, get_reg_name(inst->rs1));
+                break;
+            }
+            case I_BEQ: case I_BNE: case I_BLT: case I_BGE: case I_BLTU: case I_BGEU: {
+                static const char *names[] = { [I_BEQ] = "BEQ", [I_BNE] = "BNE", [I_BLT] = "BLT", [I_BGE] = "BGE",
+                                               [I_BLTU] = "BLTU", [I_BGEU] = "BGEU" };
+                printf("%s %s, %s, ", names[inst->type], get_reg_name(inst->rs1), get_reg_name(inst->rs2));
+                if (inst->label != SYMBOL_ID_NONE) printf("<etiket #%u>\n", inst->label);
+                else printf("%+d\n", inst->immediate);
+                break;
+            }
+            case I_JAL:
+                printf("JAL %s, ", get_reg_name(inst->rd));
+                if (inst->label != SYMBOL_ID_NONE) printf("<etiket #%u>\n", inst->label);
+                else printf("%+d\n", inst->immediate);
+                break;
+            case I_JALR:
+                printf("JALR %s, %d(%s)\n", get_reg_name(inst->rd), inst->immediate, get_reg_name(inst->rs1));
+                break;
+            case I_LUI:
+                printf("LUI %s, 0x%X\n", get_reg_name(inst->rd), (uint32_t)inst->immediate & 0xFFFFF);
+                break;
+            case I_AUIPC:
+                printf("AUIPC %s, 0x%X\n", get_reg_name(inst->rd), (uint32_t)inst->immediate & 0xFFFFF);
                 break;
-            case I_SW: 
-                printf("SW %s, %d(%s)\n", get_reg_name(inst->rs2), inst->immediate, get_reg_name(inst->rs1)); 
+            case I_FENCE:
+                printf("FENCE\n");
+                break;
+            case I_ECALL:
+                printf("ECALL\n");
+                break;
+            case I_EBREAK:
+                printf("EBREAK\n");
                 break;
             case I_A_HALT: 
                 printf("HALT (Sanal Komut)\n"); 
                 break;
+            case I_A_CALL:
+                printf("CALL <etiket #%u> (Sanal Komut)\n", inst->label);
+                break;
+            case I_A_LABEL:
+                printf("<etiket #%u>: (Sanal Komut)\n", inst->label);
+                break;
             // ... diğer komutlar
             default: printf("UNKNOWN_INST\n");
         }
@@ -14,14 +14,27 @@ typedef enum {
     R_T0 = 5, R_T1, R_T2,
     // S-Kayitlar (Saved) - Bessambly Kayitlarini tutmak icin kullanilabilir
     R_S0 = 8, R_S1, R_S2, R_S3, 
-    // SP: Yigin Isaretcisi (Stack Pointer), GP: Global Pointer
-    R_SP = 2, R_GP = 3,
-    // Zero Register
-    R_ZERO = 0,
-    // Kalan T/S kayitlarinin kullanilabilecegi varsayilmistir.
-    R_COUNT = 32
+    // SP: Yigin Isaretcisi (Stack Pointer), GP: Global Pointer, TP: Thread Pointer (yardimci rutinlerin gecici kaydi)
+    R_SP = 2, R_GP = 3, R_TP = 4,
+    // Zero Register, RA: Donus Adresi (Bessambly cagri yapmadigi icin atanabilir)
+    R_ZERO = 0, R_RA = 1,
+    // Yuksek T-Kayitlar (x28-x31). T5/T6 tasma (spill) kodu icin ayrilmistir.
+    R_T3 = 28, R_T4, R_T5, R_T6,
+    R_COUNT = 32,
+    // Sanal Kayitlar: Bessambly kayitlari (A, SUM, ...) kayit atamasina kadar
+    // R_VIRTUAL_BASE + isim kimligi olarak temsil edilir.
+    R_VIRTUAL_BASE = R_COUNT
 } Register;
 
+// Kaydin sanal (henuz fiziksel kayda atanmamis) olup olmadigini kontrol eder
+#define REGISTER_IS_VIRTUAL(r) ((r) >= R_VIRTUAL_BASE)
+
+// Her Bessambly kaydı (A, SUM, N_VALUE...) isim kimliğinden türetilen bir sanal kayda eşlenir.
+// Fiziksel kayıtlar optimizasyondan sonra kayıt atayıcı (regalloc.c) tarafından seçilir.
+static inline Register register_from_name(SymbolId name) {
+    return (Register)(R_VIRTUAL_BASE + name);
+}
+
 // RISC-V Talimat Tipleri (Sadece Bessambly'nin ihtiyac duyduklari)
 typedef enum {
     // Aritmetik/Mantık (R-Type ve I-Type)
@@ -30,39 +43,83 @@ typedef enum {
     I_ADD,     // Add: rd = rs1 + rs2
     I_ANDI,    // And Immediate: rd = rs1 & imm
     I_ORI,     // Or Immediate: rd = rs1 | imm
+    I_AND,     // And: rd = rs1 & rs2
+    I_OR,      // Or: rd = rs1 | rs2
+    I_SLLI,    // Shift Left Logical Immediate: rd = rs1 << imm
+    I_SRLI,    // Shift Right Logical Immediate: rd = rs1 >> imm (sıfır doldurarak)
+    I_SRAI,    // Shift Right Arithmetic Immediate: rd = rs1 >> imm (işaret doldurarak)
+    I_MUL,     // Multiply (RV32M): rd = rs1 * rs2
+    I_DIV,     // Divide (RV32M, işaretli): rd = rs1 / rs2
+    I_MULH,    // Multiply High (RV32M, işaretli): rd = (rs1 * rs2) >> 32
+    I_DIVU,    // Divide Unsigned (RV32M): rd = rs1 / rs2 (işaretsiz)
+    I_REM,     // Remainder (RV32M, işaretli): rd = rs1 % rs2
+    I_XORI,    // Xor Immediate: rd = rs1 ^ imm
+    I_SLTI,    // Set Less Than Immediate: rd = (rs1 < imm) ? 1 : 0
+    I_SLTIU,   // Set Less Than Immediate Unsigned
+    I_XOR,     // Xor: rd = rs1 ^ rs2
+    I_SLL,     // Shift Left Logical: rd = rs1 << rs2[4:0]
+    I_SRL,     // Shift Right Logical: rd = rs1 >> rs2[4:0] (sıfır doldurarak)
+    I_SRA,     // Shift Right Arithmetic: rd = rs1 >> rs2[4:0] (işaret doldurarak)
+    I_SLT,     // Set Less Than: rd = (rs1 < rs2) ? 1 : 0
+    I_SLTU,    // Set Less Than Unsigned
+    I_MULHSU,  // Multiply High Signed-Unsigned (RV32M)
+    I_MULHU,   // Multiply High Unsigned (RV32M)
+    I_REMU,    // Remainder Unsigned (RV32M)
     
     // Yükleme/Depolama (I-Type ve S-Type)
     I_LW,      // Load Word: rd = MEM[rs1 + offset]
     I_SW,      // Store Word: MEM[rs1 + offset] = rs2
+    I_LB,      // Load Byte (işaret genişletilir)
+    I_LH,      // Load Halfword (işaret genişletilir)
+    I_LBU,     // Load Byte Unsigned
+    I_LHU,     // Load Halfword Unsigned
+    I_SB,      // Store Byte: MEM[rs1 + offset] = rs2[7:0]
+    I_SH,      // Store Halfword: MEM[rs1 + offset] = rs2[15:0]
     
     // Atlama/Dallanma (B-Type)
     I_BEQ,     // Branch Equal: if (rs1 == rs2) branch
     I_BNE,     // Branch Not Equal: if (rs1 != rs2) branch
     I_BLT,     // Branch Less Than
     I_BGE,     // Branch Greater or Equal
-    I_JAL,     // Jump and Link (Şimdilik GOTO için kullanılmayabilir, B tipi yeterli)
-    I_JALR,    // Jump and Link Register
+    I_BLTU,    // Branch Less Than Unsigned
+    I_BGEU,    // Branch Greater or Equal Unsigned
+    I_JAL,     // Jump and Link: rd = pc + 4, pc += offset (GOTO için rd = x0)
+    I_JALR,    // Jump and Link Register: rd = pc + 4, pc = rs1 + imm
     
     // Özel
     I_LUI,     // Load Upper Immediate
-    I_A_HALT   // Programin sonu icin (Gercek RISC-V komutu degil, sanal makineyi durdurur)
+    I_AUIPC,   // Add Upper Immediate to PC: rd = pc + (imm << 12) (uzak atlamalar için)
+    I_FENCE,   // Bellek sıralama bariyeri (fence iorw, iorw)
+    I_ECALL,   // Ortam çağrısı (sistem çağrısı)
+    I_EBREAK,  // Hata ayıklayıcıya dönüş
+    I_A_HALT,  // Programin sonu icin (Gercek RISC-V komutu degil, sanal makineyi durdurur)
+    I_A_CALL,  // Yardımcı rutin çağrısı (sanal komut): label = rutin. Argümanlar T0/T1, sonuç T0.
+               // Dönüş adresi rd'ye (T2) yazılır; yerleşim geçişinde JAL t2, rutin olur.
+    I_A_LABEL  // Etiket konumu (Sanal komut, 0 bayt). Yerleşim geçişinde kaldırılır.
 } InstructionType;
 
 // Tek bir RISC-V talimatını temsil eden yapı
 typedef struct {
     InstructionType type;
-    Register rd;       // Hedef kayıt (Destination)
+    Register rd;       // Hedef kayıt (Destination), kayıt atamasından önce sanal olabilir
     Register rs1;      // Kaynak kayıt 1
     Register rs2;      // Kaynak kayıt 2 (R-Type)
-    int32_t immediate; // Sabit değer veya offset/adres (I/S/B-Type)
-    char label_name[MAX_LABEL_LENGTH]; // Atlama talimatları için hedef etiket adı
+    int32_t immediate; // Sabit değer veya offset/adres (I/S/B/J/U-Type)
+    SymbolId label;    // Atlama talimatları: hedef etiket, I_A_LABEL: tanımlanan etiket (yoksa SYMBOL_ID_NONE)
 } Instruction;
 
+// Hedef komut kümesi (-march)
+typedef enum {
+    ISA_RV32I,  // Temel tamsayı kümesi: Çarpma/bölme yazılım yardımcı rutinleriyle yapılır
+    ISA_RV32IM  // M eklentisi: MUL/MULH/DIV/DIVU/REM donanımda
+} TargetIsa;
+
 // Üretilen tüm talimat dizisini tutan yapı
 typedef struct {
     Instruction *instructions;
     size_t count;
     size_t capacity;
+    uint64_t spill_base; // Taşma (spill) alanının başlangıç adresi (bkz. addressing.h)
 } CodeBuffer;
 
 // --- Kod Üretimi Ana İşlevleri ---
@@ -72,13 +129,31 @@ typedef struct {
  */
 CodeBuffer *code_buffer_init();
 
+/**
+ * @brief Arabelleğin sonuna bir talimat ekler (gerekirse arabelleği büyütür).
+ */
+void code_buffer_append(CodeBuffer *buffer, Instruction inst);
+
 /**
  * @brief AST'yi dolaşır ve RISC-V talimatlarını CodeBuffer'a üretir.
  * @param program: AST'nin kök düğümü.
  * @param sym_table: Sembol Tablosu (Etiket adresleri için gereklidir).
+ * @param isa: Hedef komut kümesi (çarpma/bölme talimatlarının seçimi için).
+ * @return CodeBuffer*: Üretilen talimatları içeren arabellek.
+ */
+CodeBuffer *generate_riscv_code(AST_Program *program, SymbolTable *sym_table, TargetIsa isa);
+
+/**
+ * @brief Anlambilim analizini ve kod üretimini AST üzerinde tek geçişte yapar.
+ * Etiketler geçiş sırasında toplanır; henüz tanımlanmamış etiketlere yapılan atlamalar
+ * bir düzeltme (fixup) listesine eklenir ve geçiş bittiğinde çözülür. Tanımsız etiketler
+ * bu noktada raporlanır. analyze_semantic + generate_riscv_code ile aynı çıktıyı üretir.
+ * @param program: AST.
+ * @param sym_table: Boş Sembol Tablosu (etiketler bu işlev tarafından eklenir).
+ * @param isa: Hedef komut kümesi.
  * @return CodeBuffer*: Üretilen talimatları içeren arabellek.
  */
-CodeBuffer *generate_riscv_code(AST_Program *program, SymbolTable *sym_table);
+CodeBuffer *generate_riscv_code_single_pass(AST_Program *program, SymbolTable *sym_table, TargetIsa isa);
 
 /**
  * @brief CodeBuffer için ayrılan belleği serbest bırakır.
@@ -0,0 +1,550 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "isel.h"
+
+// --- Maliyet Modeli (yaklaşık çevrim sayısı) ---
+#define ISEL_COST_ALU   1
+#define ISEL_COST_LOAD  2
+#define ISEL_COST_MUL   3
+#define ISEL_COST_DIV   32
+#define ISEL_COST_MUL_CALL 100 // Kaydır-topla rutini: çağrı + çarpanın bit başına ~6 talimat
+#define ISEL_COST_DIV_CALL 340 // Geri yüklemeli bölme rutini: 32 tur x ~10 talimat
+#define ISEL_NO_MATCH   INT_MAX
+
+// Sabitle çarpma dizisinin en fazla talimat sayısı (daha uzunu MUL veya rutin çağrısıyla yapılır)
+#define ISEL_MUL_SEQ_LIMIT 16
+// Dizinin üretim arabelleği: 32 bitlik NAF en fazla 16 sıfırdan farklı basamak içerir (kaydır + topla)
+#define ISEL_MUL_SEQ_CAPACITY 40
+
+// Kuralın geçerli olduğu hedef komut kümeleri
+#define TARGET_BIT(isa) (1u << (isa))
+#define TARGET_BASE     TARGET_BIT(ISA_RV32I)
+#define TARGET_M        TARGET_BIT(ISA_RV32IM)
+#define TARGET_ALL      (TARGET_BASE | TARGET_M)
+
+// Terminal olmayanlar: Bir yaprağın talimatta kullanılabileceği biçimler
+typedef enum {
+    NT_REG,       // Bir kayıttaki değer (sanal kayıt, x0 veya T0/T1'e yüklenmiş sabit/bellek)
+    NT_IMM12,     // 12-bit işaretli sabit (I-Tipi immediate)
+    NT_NEG_IMM12, // Negatifi 12-bit işaretli sabite sığan sabit (A - 5 -> ADDI A, -5)
+    NT_POW2,      // Pozitif ikinin kuvveti (kaydırma miktarı olarak)
+    NT_MUL_SEQ,   // Kaydırma/toplama dizisiyle çarpılabilen sabit (maliyet: dizi uzunluğu)
+    NT_DIV_MAGIC, // Sihirli sayı çarpımıyla (MULH) bölünebilen sabit (maliyet: ek talimatlar)
+    NT_COUNT
+} Nonterminal;
+
+// Bir yaprağın her terminal olmayana indirgenme maliyeti
+typedef struct {
+    int cost[NT_COUNT];
+} LeafLabel;
+
+// Kuralın talimat üretme biçimi
+typedef enum {
+    EMIT_R,         // OP rd, sol, sağ
+    EMIT_I,         // OPI rd, sol, sağ_sabit
+    EMIT_I_SWAP,    // OPI rd, sağ, sol_sabit (değişmeli işlemler)
+    EMIT_I_NEG,     // ADDI rd, sol, -sağ_sabit
+    EMIT_SHIFT,     // SLLI rd, sol, log2(sağ)
+    EMIT_SHIFT_SWAP,// SLLI rd, sağ, log2(sol)
+    EMIT_DIV_POW2,  // İşaretli bölme: sıfıra doğru yuvarlamak için negatif sayılara (2^k - 1) eklenir
+    EMIT_MUL_SEQ,   // Sol * sağ_sabit: kaydırma ve toplama/çıkarma dizisi
+    EMIT_MUL_SEQ_SWAP, // Sağ * sol_sabit
+    EMIT_DIV_MAGIC, // Sol / sağ_sabit: MULH ile sihirli sayı çarpımı ve düzeltme
+    EMIT_CALL       // Yardımcı rutin çağrısı: sol T0'a, sağ T1'e, sonuç T0'dan rd'ye
+} EmitKind;
+
+// İkili işlem kuralı: op(sol, sağ) -> kayıt
+typedef struct {
+    BinaryOperatorType op;
+    Nonterminal left;
+    Nonterminal right;
+    int cost;
+    InstructionType inst;
+    EmitKind emit;
+    unsigned targets; // Kuralın geçerli olduğu komut kümeleri (TARGET_*)
+} BinaryRule;
+
+static const BinaryRule binary_rules[] = {
+    {OP_BIN_ADD, NT_REG,      NT_REG,       ISEL_COST_ALU,      I_ADD,    EMIT_R,            TARGET_ALL},
+    {OP_BIN_ADD, NT_REG,      NT_IMM12,     ISEL_COST_ALU,      I_ADDI,   EMIT_I,            TARGET_ALL},
+    {OP_BIN_ADD, NT_IMM12,    NT_REG,       ISEL_COST_ALU,      I_ADDI,   EMIT_I_SWAP,       TARGET_ALL},
+    {OP_BIN_SUB, NT_REG,      NT_REG,       ISEL_COST_ALU,      I_SUB,    EMIT_R,            TARGET_ALL},
+    {OP_BIN_SUB, NT_REG,      NT_NEG_IMM12, ISEL_COST_ALU,      I_ADDI,   EMIT_I_NEG,        TARGET_ALL},
+    {OP_BIN_AND, NT_REG,      NT_REG,       ISEL_COST_ALU,      I_AND,    EMIT_R,            TARGET_ALL},
+    {OP_BIN_AND, NT_REG,      NT_IMM12,     ISEL_COST_ALU,      I_ANDI,   EMIT_I,            TARGET_ALL},
+    {OP_BIN_AND, NT_IMM12,    NT_REG,       ISEL_COST_ALU,      I_ANDI,   EMIT_I_SWAP,       TARGET_ALL},
+    {OP_BIN_OR,  NT_REG,      NT_REG,       ISEL_COST_ALU,      I_OR,     EMIT_R,            TARGET_ALL},
+    {OP_BIN_OR,  NT_REG,      NT_IMM12,     ISEL_COST_ALU,      I_ORI,    EMIT_I,            TARGET_ALL},
+    {OP_BIN_OR,  NT_IMM12,    NT_REG,       ISEL_COST_ALU,      I_ORI,    EMIT_I_SWAP,       TARGET_ALL},
+    {OP_BIN_MUL, NT_REG,      NT_REG,       ISEL_COST_MUL,      I_MUL,    EMIT_R,            TARGET_M},
+    {OP_BIN_MUL, NT_REG,      NT_REG,       ISEL_COST_MUL_CALL, I_A_CALL, EMIT_CALL,         TARGET_BASE},
+    {OP_BIN_MUL, NT_REG,      NT_POW2,      ISEL_COST_ALU,      I_SLLI,   EMIT_SHIFT,        TARGET_ALL},
+    {OP_BIN_MUL, NT_POW2,     NT_REG,       ISEL_COST_ALU,      I_SLLI,   EMIT_SHIFT_SWAP,   TARGET_ALL},
+    {OP_BIN_MUL, NT_REG,      NT_MUL_SEQ,   0,                  I_ADD,    EMIT_MUL_SEQ,      TARGET_ALL},
+    {OP_BIN_MUL, NT_MUL_SEQ,  NT_REG,       0,                  I_ADD,    EMIT_MUL_SEQ_SWAP, TARGET_ALL},
+    {OP_BIN_DIV, NT_REG,      NT_REG,       ISEL_COST_DIV,      I_DIV,    EMIT_R,            TARGET_M},
+    {OP_BIN_DIV, NT_REG,      NT_REG,       ISEL_COST_DIV_CALL, I_A_CALL, EMIT_CALL,         TARGET_BASE},
+    {OP_BIN_DIV, NT_REG,      NT_POW2,      4 * ISEL_COST_ALU,  I_SRAI,   EMIT_DIV_POW2,     TARGET_ALL},
+    {OP_BIN_DIV, NT_REG,      NT_DIV_MAGIC, ISEL_COST_MUL,      I_MULH,   EMIT_DIV_MAGIC,    TARGET_M},
+};
+#define BINARY_RULE_COUNT (sizeof(binary_rules) / sizeof(binary_rules[0]))
+
+// --- Yardımcı İşlevler ---
+
+static bool fits_imm12(long long value) {
+    return value >= -2048 && value <= 2047;
+}
+
+/**
+ * @brief Pozitif ikinin kuvveti ise üssünü, değilse -1 döndürür.
+ */
+static int power_of_two_shift(long long value) {
+    if (value <= 0 || value > (1LL << 30) || (value & (value - 1)) != 0) return -1;
+    int shift = 0;
+    while ((1LL << shift) != value) shift++;
+    return shift;
+}
+
+/**
+ * @brief rd = x * multiplier dizisini üretir (M eklentisi gerektirmez).
+ * Çarpan NAF (komşu olmayan biçim) basamaklarına (-1, 0, 1) ayrılır ve Horner yöntemiyle
+ * en üst basamaktan başlanarak hesaplanır: ardışık sıfırlar tek SLLI'de birleşir, her
+ * sıfırdan farklı basamak bir ADD/SUB ekler (x * 7 = (x << 3) - x). Ara sonuçlar T1'de
+ * tutulur ve yalnızca son talimat rd'ye yazar; bu yüzden rd == x olabilir.
+ * @param sequence: Çıktı talimatları (en fazla ISEL_MUL_SEQ_CAPACITY).
+ * @return int: Üretilen talimat sayısı.
+ */
+static int multiply_sequence(int32_t multiplier, Register x, Register rd, Instruction *sequence) {
+    if (multiplier == 0) {
+        sequence[0] = (Instruction){I_ADDI, rd, R_ZERO, R_ZERO, 0, SYMBOL_ID_NONE};
+        return 1;
+    }
+
+    // NAF basamakları (en düşükten); işaretli değer doğrudan ayrıştırılır
+    int digits[33];
+    int top = -1;
+    for (long long m = multiplier; m != 0; m /= 2) {
+        int digit = 0;
+        if (m & 1) {
+            digit = 2 - (int)(((m % 4) + 4) % 4); // m = 1 (mod 4) -> 1, m = 3 (mod 4) -> -1
+            m -= digit;
+        }
+        digits[++top] = digit;
+    }
+
+    int length = 0;
+    Register acc = x; // Henüz talimat üretilmediyse birikim x'in kendisidir
+    if (digits[top] < 0) {
+        sequence[length++] = (Instruction){I_SUB, R_T1, R_ZERO, x, 0, SYMBOL_ID_NONE};
+        acc = R_T1;
+    }
+    int pending_shift = 0;
+    for (int d = top - 1; d >= 0; d--) {
+        pending_shift++;
+        if (digits[d] == 0) continue;
+        sequence[length++] = (Instruction){I_SLLI, R_T1, acc, R_ZERO, pending_shift, SYMBOL_ID_NONE};
+        sequence[length++] = (Instruction){digits[d] > 0 ? I_ADD : I_SUB, R_T1, R_T1, x, 0, SYMBOL_ID_NONE};
+        acc = R_T1;
+        pending_shift = 0;
+    }
+    if (pending_shift > 0) {
+        sequence[length++] = (Instruction){I_SLLI, R_T1, acc, R_ZERO, pending_shift, SYMBOL_ID_NONE};
+    }
+
+    if (length == 0) {
+        sequence[length++] = (Instruction){I_ADD, rd, x, R_ZERO, 0, SYMBOL_ID_NONE}; // x * 1
+    } else {
+        sequence[length - 1].rd = rd;
+    }
+    return length;
+}
+
+/**
+ * @brief İşaretli bölme için sihirli sayıyı ve kaydırma miktarını hesaplar (Hacker's Delight, 10-1).
+ * x / divisor = (MULH(x, multiplier) [+/- x]) >> shift, negatifse + 1.
+ * @return bool: Bölen 2 <= |divisor| < 2^31 aralığındaysa true.
+ */
+static bool division_magic(int32_t divisor, int32_t *multiplier, int *shift) {
+    if (divisor == INT32_MIN || (divisor >= -1 && divisor <= 1)) return false;
+
+    const uint32_t two31 = 0x80000000u;
+    uint32_t ad = divisor < 0 ? -(uint32_t)divisor : (uint32_t)divisor;
+    uint32_t t = two31 + ((uint32_t)divisor >> 31);
+    uint32_t anc = t - 1 - t % ad; // |nc|: en büyük uygun bölünenin mutlak değeri
+    int p = 31;
+    uint32_t q1 = two31 / anc, r1 = two31 - q1 * anc;
+    uint32_t q2 = two31 / ad, r2 = two31 - q2 * ad;
+    uint32_t delta;
+    do {
+        p++;
+        q1 *= 2; r1 *= 2;
+        if (r1 >= anc) { q1++; r1 -= anc; }
+        q2 *= 2; r2 *= 2;
+        if (r2 >= ad) { q2++; r2 -= ad; }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    uint32_t magic = q2 + 1;
+    *multiplier = (int32_t)(divisor < 0 ? -magic : magic);
+    *shift = p - 32;
+    return true;
+}
+
+/**
+ * @brief Sihirli sayı bölmesinin MULH dışındaki talimat sayısı (düzeltme, kaydırma, yuvarlama).
+ */
+static int division_magic_extra(int32_t divisor, int32_t multiplier, int shift) {
+    int extra = 2; // SRLI (işaret biti) + ADD
+    if ((divisor > 0 && multiplier < 0) || (divisor < 0 && multiplier > 0)) extra++;
+    if (shift > 0) extra++;
+    return extra;
+}
+
+/**
+ * @brief Sabiti mevcut bloğun önbelleğinde arar.
+ * @return Register: Sabiti tutan sanal kayıt, yoksa R_ZERO.
+ */
+static Register find_constant(const IselContext *context, int32_t value) {
+    for (size_t c = 0; c < context->constant_count; c++) {
+        if (context->constants[c].value == value) return context->constants[c].reg;
+    }
+    return R_ZERO;
+}
+
+/**
+ * @brief 12 bite sığmayan sabiti tutan kaydı döndürür. Sabit bu blokta henüz yüklenmemişse
+ * yeni bir sabit sanal kaydına LUI(+ADDI) ile yüklenir ve önbelleğe eklenir.
+ */
+static Register load_large_constant(IselContext *context, int32_t value, CodeBuffer *buffer) {
+    Register reg = find_constant(context, value);
+    if (reg != R_ZERO) return reg;
+
+    reg = context->next_register++;
+    Instruction sequence[2];
+    int length = isel_constant_sequence(value, reg, sequence);
+    for (int k = 0; k < length; k++) code_buffer_append(buffer, sequence[k]);
+
+    // Önbellek doluysa sabit yine doğru yüklenir, yalnızca tekrar kullanılmaz
+    if (context->constant_count < ISEL_CONSTANT_CACHE_SIZE) {
+        context->constants[context->constant_count++] = (IselConstant){value, reg};
+    }
+    return reg;
+}
+
+/**
+ * @brief MEM[adres] değerini rd kaydına yükler: LW rd, ofset(taban).
+ */
+static void emit_memory_load(const IselContext *context, Register rd, long long address, CodeBuffer *buffer) {
+    Register base;
+    int32_t offset;
+    address_plan_resolve(&context->addresses, address, &base, &offset);
+    code_buffer_append(buffer, (Instruction){I_LW, rd, base, R_ZERO, offset, SYMBOL_ID_NONE});
+}
+
+/**
+ * @brief Yaprağı etiketler: Her terminal olmayan için indirgeme maliyeti.
+ */
+static LeafLabel label_leaf(const IselContext *context, const AST_Operand *opr) {
+    LeafLabel label;
+    for (int nt = 0; nt < NT_COUNT; nt++) label.cost[nt] = ISEL_NO_MATCH;
+
+    switch (opr->type) {
+        case OPR_TYPE_REGISTER:
+            label.cost[NT_REG] = 0;
+            break;
+        case OPR_TYPE_MEMORY_ADDR:
+            label.cost[NT_REG] = ISEL_COST_LOAD;
+            break;
+        case OPR_TYPE_IMMEDIATE_INT:
+            // 0 sabiti x0 olarak ve bu blokta yüklenmiş sabitler bedavadır; diğerleri ADDI,
+            // LUI veya LUI+ADDI ile yüklenir
+            if (opr->value == 0 || find_constant(context, (int32_t)opr->value) != R_ZERO) {
+                label.cost[NT_REG] = 0;
+            } else {
+                Instruction sequence[2];
+                label.cost[NT_REG] = ISEL_COST_ALU * isel_constant_sequence((int32_t)opr->value, R_ZERO, sequence);
+            }
+            if (fits_imm12(opr->value)) label.cost[NT_IMM12] = 0;
+            if (fits_imm12(-opr->value)) label.cost[NT_NEG_IMM12] = 0;
+            if (power_of_two_shift(opr->value) >= 0) label.cost[NT_POW2] = 0;
+            {
+                Instruction sequence[ISEL_MUL_SEQ_CAPACITY];
+                int length = multiply_sequence((int32_t)opr->value, R_T0, R_T0, sequence);
+                if (length <= ISEL_MUL_SEQ_LIMIT) label.cost[NT_MUL_SEQ] = ISEL_COST_ALU * length;
+
+                int32_t multiplier;
+                int shift;
+                if (division_magic((int32_t)opr->value, &multiplier, &shift)) {
+                    int load = 0;
+                    if (find_constant(context, multiplier) == R_ZERO) {
+                        load = isel_constant_sequence(multiplier, R_ZERO, sequence);
+                    }
+                    label.cost[NT_DIV_MAGIC] = ISEL_COST_ALU * (load + division_magic_extra((int32_t)opr->value, multiplier, shift));
+                }
+            }
+            break;
+    }
+    return label;
+}
+
+/**
+ * @brief Yaprağın değerini taşıyan kaydı döndürür; gerekiyorsa geçici kayda yükler.
+ * @param scratch: 12-bit sabit ve bellek operantları için kullanılacak geçici kayıt (T0/T1).
+ */
+static Register reduce_to_register(IselContext *context, const AST_Operand *opr, Register scratch, CodeBuffer *buffer) {
+    switch (opr->type) {
+        case OPR_TYPE_REGISTER:
+            return register_from_name(opr->name);
+        case OPR_TYPE_MEMORY_ADDR:
+            emit_memory_load(context, scratch, opr->mem_address, buffer);
+            return scratch;
+        case OPR_TYPE_IMMEDIATE_INT:
+        default:
+            if (opr->value == 0) return R_ZERO;
+            if (!fits_imm12(opr->value)) return load_large_constant(context, (int32_t)opr->value, buffer);
+            code_buffer_append(buffer, (Instruction){I_ADDI, scratch, R_ZERO, R_ZERO, (int32_t)opr->value, SYMBOL_ID_NONE});
+            return scratch;
+    }
+}
+
+/**
+ * @brief Tek operantlı ifadeyi (A = B, A = 10, A = MEM[0x10]) doğrudan hedef kayda üretir.
+ */
+static void select_operand(IselContext *context, const AST_Operand *opr, Register rd, CodeBuffer *buffer) {
+    switch (opr->type) {
+        case OPR_TYPE_REGISTER:
+            // Kaydı kopyala (rd = rs + x0); kayıt atayıcı kopyayı birleştirebilir
+            code_buffer_append(buffer, (Instruction){I_ADD, rd, register_from_name(opr->name), R_ZERO, 0, SYMBOL_ID_NONE});
+            break;
+        case OPR_TYPE_MEMORY_ADDR:
+            emit_memory_load(context, rd, opr->mem_address, buffer);
+            break;
+        case OPR_TYPE_IMMEDIATE_INT: {
+            // Bu blokta yüklenmiş sabit kopyalanır, diğerleri doğrudan hedef kayda yüklenir
+            Register constant = find_constant(context, (int32_t)opr->value);
+            if (constant != R_ZERO) {
+                code_buffer_append(buffer, (Instruction){I_ADD, rd, constant, R_ZERO, 0, SYMBOL_ID_NONE});
+                break;
+            }
+            Instruction sequence[2];
+            int length = isel_constant_sequence((int32_t)opr->value, rd, sequence);
+            for (int k = 0; k < length; k++) code_buffer_append(buffer, sequence[k]);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief İkili ifade için en düşük maliyetli kuralı seçer ve sonucu rd kaydına üretir.
+ */
+static void select_binary(IselContext *context, const AST_Expr *expr, Register rd, CodeBuffer *buffer) {
+    const AST_Operand *left = &expr->data.binary_op.left;
+    const AST_Operand *right = &expr->data.binary_op.right;
+    LeafLabel left_label = label_leaf(context, left);
+    LeafLabel right_label = label_leaf(context, right);
+
+    // 1. Etiketleme: İşlemle eşleşen kurallar arasından toplam maliyeti en düşük olanı bul
+    const BinaryRule *best = NULL;
+    int best_cost = ISEL_NO_MATCH;
+    for (size_t r = 0; r < BINARY_RULE_COUNT; r++) {
+        const BinaryRule *rule = &binary_rules[r];
+        if (rule->op != expr->data.binary_op.op) continue;
+        if (!(rule->targets & TARGET_BIT(context->isa))) continue;
+        int left_cost = left_label.cost[rule->left];
+        int right_cost = right_label.cost[rule->right];
+        if (left_cost == ISEL_NO_MATCH || right_cost == ISEL_NO_MATCH) continue;
+        int cost = rule->cost + left_cost + right_cost;
+        if (cost < best_cost) {
+            best = rule;
+            best_cost = cost;
+        }
+    }
+    // Her işlem ve hedef için (REG, REG) kuralı bulunduğundan best NULL olamaz
+
+    // 2. İndirgeme: Kuralın talimatlarını üret
+    Register rs1, rs2;
+    int shift, length;
+    int32_t multiplier;
+    Instruction sequence[ISEL_MUL_SEQ_CAPACITY];
+    switch (best->emit) {
+        case EMIT_R:
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            rs2 = reduce_to_register(context, right, R_T1, buffer);
+            code_buffer_append(buffer, (Instruction){best->inst, rd, rs1, rs2, 0, SYMBOL_ID_NONE});
+            break;
+        case EMIT_I:
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            code_buffer_append(buffer, (Instruction){best->inst, rd, rs1, R_ZERO, (int32_t)right->value, SYMBOL_ID_NONE});
+            break;
+        case EMIT_I_SWAP:
+            rs1 = reduce_to_register(context, right, R_T0, buffer);
+            code_buffer_append(buffer, (Instruction){best->inst, rd, rs1, R_ZERO, (int32_t)left->value, SYMBOL_ID_NONE});
+            break;
+        case EMIT_I_NEG:
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            code_buffer_append(buffer, (Instruction){best->inst, rd, rs1, R_ZERO, (int32_t)-right->value, SYMBOL_ID_NONE});
+            break;
+        case EMIT_SHIFT:
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            code_buffer_append(buffer, (Instruction){best->inst, rd, rs1, R_ZERO, power_of_two_shift(right->value), SYMBOL_ID_NONE});
+            break;
+        case EMIT_SHIFT_SWAP:
+            rs1 = reduce_to_register(context, right, R_T0, buffer);
+            code_buffer_append(buffer, (Instruction){best->inst, rd, rs1, R_ZERO, power_of_two_shift(left->value), SYMBOL_ID_NONE});
+            break;
+        case EMIT_DIV_POW2:
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            shift = power_of_two_shift(right->value);
+            if (shift == 0) {
+                // A / 1 = A
+                code_buffer_append(buffer, (Instruction){I_ADD, rd, rs1, R_ZERO, 0, SYMBOL_ID_NONE});
+                break;
+            }
+            // t1 = (A >> 31) >>> (32 - k)  (A < 0 ise 2^k - 1, değilse 0); rd = (A + t1) >> k
+            code_buffer_append(buffer, (Instruction){I_SRAI, R_T1, rs1, R_ZERO, 31, SYMBOL_ID_NONE});
+            code_buffer_append(buffer, (Instruction){I_SRLI, R_T1, R_T1, R_ZERO, 32 - shift, SYMBOL_ID_NONE});
+            code_buffer_append(buffer, (Instruction){I_ADD, R_T1, rs1, R_T1, 0, SYMBOL_ID_NONE});
+            code_buffer_append(buffer, (Instruction){I_SRAI, rd, R_T1, R_ZERO, shift, SYMBOL_ID_NONE});
+            break;
+        case EMIT_MUL_SEQ:
+        case EMIT_MUL_SEQ_SWAP: {
+            const AST_Operand *value = best->emit == EMIT_MUL_SEQ ? left : right;
+            const AST_Operand *constant = best->emit == EMIT_MUL_SEQ ? right : left;
+            rs1 = reduce_to_register(context, value, R_T0, buffer);
+            length = multiply_sequence((int32_t)constant->value, rs1, rd, sequence);
+            for (int k = 0; k < length; k++) code_buffer_append(buffer, sequence[k]);
+            break;
+        }
+        case EMIT_DIV_MAGIC: {
+            int32_t divisor = (int32_t)right->value;
+            division_magic(divisor, &multiplier, &shift);
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            if (fits_imm12(multiplier)) {
+                code_buffer_append(buffer, (Instruction){I_ADDI, R_T1, R_ZERO, R_ZERO, multiplier, SYMBOL_ID_NONE});
+                rs2 = R_T1;
+            } else {
+                rs2 = load_large_constant(context, multiplier, buffer);
+            }
+            // t1 = hi(A * M) [+/- A] >> s; rd = t1 + (t1 >>> 31)  (negatif bölüm sıfıra doğru yuvarlanır)
+            code_buffer_append(buffer, (Instruction){I_MULH, R_T1, rs1, rs2, 0, SYMBOL_ID_NONE});
+            if (divisor > 0 && multiplier < 0) {
+                code_buffer_append(buffer, (Instruction){I_ADD, R_T1, R_T1, rs1, 0, SYMBOL_ID_NONE});
+            } else if (divisor < 0 && multiplier > 0) {
+                code_buffer_append(buffer, (Instruction){I_SUB, R_T1, R_T1, rs1, 0, SYMBOL_ID_NONE});
+            }
+            if (shift > 0) {
+                code_buffer_append(buffer, (Instruction){I_SRAI, R_T1, R_T1, R_ZERO, shift, SYMBOL_ID_NONE});
+            }
+            code_buffer_append(buffer, (Instruction){I_SRLI, R_T0, R_T1, R_ZERO, 31, SYMBOL_ID_NONE});
+            code_buffer_append(buffer, (Instruction){I_ADD, rd, R_T1, R_T0, 0, SYMBOL_ID_NONE});
+            break;
+        }
+        case EMIT_CALL: {
+            RuntimeRoutine routine = expr->data.binary_op.op == OP_BIN_MUL ? RUNTIME_MUL : RUNTIME_DIV;
+            rs1 = reduce_to_register(context, left, R_T0, buffer);
+            if (rs1 != R_T0) code_buffer_append(buffer, (Instruction){I_ADD, R_T0, rs1, R_ZERO, 0, SYMBOL_ID_NONE});
+            rs2 = reduce_to_register(context, right, R_T1, buffer);
+            if (rs2 != R_T1) code_buffer_append(buffer, (Instruction){I_ADD, R_T1, rs2, R_ZERO, 0, SYMBOL_ID_NONE});
+            code_buffer_append(buffer, (Instruction){I_A_CALL, R_T2, R_T0, R_T1, 0,
+                                                     runtime_entry_label(routine, context->runtime_label)});
+            if (rd != R_T0) code_buffer_append(buffer, (Instruction){I_ADD, rd, R_T0, R_ZERO, 0, SYMBOL_ID_NONE});
+            context->runtime_used[routine] = true;
+            break;
+        }
+    }
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+void isel_init(IselContext *context, const AST_Program *program, TargetIsa isa, CodeBuffer *buffer) {
+    context->constant_count = 0;
+    context->isa = isa;
+    // İsim kimlikleri 1..count aralığındadır; taban ve sabit kayıtları ile rutin etiketleri onlardan sonra başlar
+    context->next_register = register_from_name(interner_count(&program->names) + 1);
+    context->runtime_label = interner_count(&program->names) + 1;
+    for (int r = 0; r < RUNTIME_ROUTINE_COUNT; r++) context->runtime_used[r] = false;
+    address_plan_build(&context->addresses, program, &context->next_register);
+    address_plan_emit_bases(&context->addresses, buffer);
+    buffer->spill_base = context->addresses.spill_base;
+}
+
+void isel_finish(IselContext *context, CodeBuffer *buffer) {
+    size_t routines = 0;
+    for (int r = 0; r < RUNTIME_ROUTINE_COUNT; r++) {
+        if (!context->runtime_used[r]) continue;
+        runtime_emit((RuntimeRoutine)r, context->runtime_label, buffer);
+        routines++;
+    }
+    if (routines > 0) {
+        printf("Yardımcı Rutinler: %zu çarpma/bölme rutini programa eklendi (RV32I).\n", routines);
+    }
+    address_plan_free(&context->addresses);
+}
+
+void isel_end_block(IselContext *context) {
+    context->constant_count = 0;
+}
+
+int isel_constant_sequence(int32_t value, Register rd, Instruction sequence[2]) {
+    if (fits_imm12(value)) {
+        sequence[0] = (Instruction){I_ADDI, rd, R_ZERO, R_ZERO, value, SYMBOL_ID_NONE};
+        return 1;
+    }
+    // value = (upper << 12) + low, low işaretli 12-bit ([-2048, 2047])
+    int32_t low = (int32_t)(((uint32_t)value & 0xFFFu) ^ 0x800u) - 0x800;
+    int32_t upper = (int32_t)(((uint32_t)value - (uint32_t)low) >> 12);
+    sequence[0] = (Instruction){I_LUI, rd, R_ZERO, R_ZERO, upper, SYMBOL_ID_NONE};
+    if (low == 0) return 1;
+    sequence[1] = (Instruction){I_ADDI, rd, rd, R_ZERO, low, SYMBOL_ID_NONE};
+    return 2;
+}
+
+void isel_assignment(IselContext *context, const AST_Program *program, AST_StmtIndex index, CodeBuffer *buffer) {
+    AST_Operand destination = ast_stmt_operand(program, index, AST_SLOT_DEST);
+    AST_Expr expression = ast_stmt_expression(program, index);
+
+    if (destination.type == OPR_TYPE_REGISTER) {
+        Register rd = register_from_name(destination.name);
+        if (expression.type == EXPR_TYPE_OPERAND) {
+            select_operand(context, &expression.data.operand, rd, buffer);
+        } else {
+            select_binary(context, &expression, rd, buffer);
+        }
+    } else if (destination.type == OPR_TYPE_MEMORY_ADDR) {
+        // MEM[adres] = ifade: Değeri taşıyan kayıt doğrudan SW'ye verilir (MEM[..] = 0 -> SW x0)
+        Register value;
+        if (expression.type == EXPR_TYPE_OPERAND) {
+            value = reduce_to_register(context, &expression.data.operand, R_T0, buffer);
+        } else {
+            select_binary(context, &expression, R_T0, buffer);
+            value = R_T0;
+        }
+        Register base;
+        int32_t offset;
+        address_plan_resolve(&context->addresses, destination.mem_address, &base, &offset);
+        code_buffer_append(buffer, (Instruction){I_SW, R_ZERO, base, value, offset, SYMBOL_ID_NONE});
+    }
+    // Sabit hedefe atama anlambilim analizinde yakalanır
+}
+
+void isel_if_goto(IselContext *context, const AST_Program *program, AST_StmtIndex index, CodeBuffer *buffer) {
+    AST_Operand left = ast_stmt_operand(program, index, AST_SLOT_LEFT);
+    AST_Operand right = ast_stmt_operand(program, index, AST_SLOT_RIGHT);
+
+    // Her iki operant da kayıt biçimine indirgenir (kayıtlar doğrudan, 0 -> x0)
+    Register rs1 = reduce_to_register(context, &left, R_T0, buffer);
+    Register rs2 = reduce_to_register(context, &right, R_T1, buffer);
+
+    InstructionType inst_type = I_BEQ;
+    switch (ast_stmt_condition(program, index)) {
+        case OP_COND_EQ: inst_type = I_BEQ; break;
+        case OP_COND_NE: inst_type = I_BNE; break;
+        case OP_COND_LT: inst_type = I_BLT; break;
+        case OP_COND_GE: inst_type = I_BGE; break;
+        case OP_COND_GT: inst_type = I_BLT; { Register t = rs1; rs1 = rs2; rs2 = t; } break; // A > B  <=>  B < A
+        case OP_COND_LE: inst_type = I_BGE; { Register t = rs1; rs1 = rs2; rs2 = t; } break; // A <= B <=>  B >= A
+    }
+
+    code_buffer_append(buffer, (Instruction){inst_type, R_ZERO, rs1, rs2, 0, ast_stmt_label(program, index)});
+}
@@ -0,0 +1,86 @@
+#ifndef BESSAMBLY_ISEL_H
+#define BESSAMBLY_ISEL_H
+
+#include "ast.h"
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+#include "addressing.h"   // MEM[] erişimlerinin taban kaydı planı için
+#include "runtime.h"      // M eklentisi olmayan hedeflerde çarpma/bölme rutinleri için
+
+/**
+ * @brief Komut Seçici (Instruction Selector)
+ * Atama ve koşul ifadeleri küçük ağaçlardır: bir operatör ve iki yaprak (kayıt, sabit, bellek).
+ * Seçici BURS yaklaşımını izler: Yapraklar önce hangi terminal olmayanlara (kayıt, 12-bit
+ * sabit, ikinin kuvveti...) hangi maliyetle indirgenebildiklerine göre etiketlenir, ardından
+ * kural tablosundan toplam maliyeti en düşük kural seçilir ve talimatlar üretilir.
+ * Kayıt operantları doğrudan sanal kayıtlarıyla, 0 sabiti doğrudan x0 ile kullanılır;
+ * T0/T1 yalnızca 12-bit sabit ve bellek operantlarını kayda yüklemek için kullanılır.
+ * Kurallar hedef komut kümesine göre süzülür: RV32IM'de MUL/MULH/DIV donanımdadır, RV32I'da
+ * çarpma ve bölme yardımcı rutin çağrısıdır. Sabitle çarpma her iki hedefte de yeterince
+ * kısaysa kaydırma/toplama dizisine, sabite bölme RV32IM'de MULH ile sihirli sayı çarpımına indirgenir.
+ */
+
+// Bir temel blok içinde tekrar kullanılabilecek büyük sabit sayısı
+#define ISEL_CONSTANT_CACHE_SIZE 16
+
+// Kayda yüklenmiş büyük sabit: değer ve onu tutan sanal kayıt
+typedef struct {
+    int32_t value;
+    Register reg;
+} IselConstant;
+
+/**
+ * @brief Komut seçici durumu.
+ * 12 bite sığmayan sabitler (LUI+ADDI) kendi sanal kayıtlarına yüklenir ve aynı temel blok
+ * içinde tekrar kullanılır. Bu kayıtlar Bessambly kayıtlarının (isim kimlikleri) üzerinden
+ * numaralanır; kayıt atayıcı baskı altında onları belleğe taşımak yerine yeniden üretir.
+ */
+typedef struct {
+    IselConstant constants[ISEL_CONSTANT_CACHE_SIZE]; // Mevcut bloktaki yüklenmiş sabitler
+    size_t constant_count;
+    Register next_register; // Sıradaki boş sabit sanal kaydı
+    AddressPlan addresses;  // MEM[] erişimlerinin taban kayıtları ve ofsetleri
+    TargetIsa isa;          // Hedef komut kümesi
+    SymbolId runtime_label; // Yardımcı rutinlere ayrılmış ilk etiket kimliği
+    bool runtime_used[RUNTIME_ROUTINE_COUNT]; // Çağrılan (programa eklenecek) rutinler
+} IselContext;
+
+/**
+ * @brief Komut seçici durumunu program için başlatır.
+ * Bellek adresleme planını oluşturur ve taban kayıtlarını program girişinde yükler;
+ * bu yüzden ilk komuttan önce çağrılmalıdır.
+ */
+void isel_init(IselContext *context, const AST_Program *program, TargetIsa isa, CodeBuffer *buffer);
+
+/**
+ * @brief Programda çağrılan yardımcı rutinleri arabelleğin sonuna (HALT'tan sonra) ekler
+ * ve komut seçici durumunun kaynaklarını serbest bırakır.
+ */
+void isel_finish(IselContext *context, CodeBuffer *buffer);
+
+/**
+ * @brief Temel blok sınırını bildirir (etiket, goto, if-goto); önbellekteki sabitler unutulur.
+ */
+void isel_end_block(IselContext *context);
+
+/**
+ * @brief 32-bit sabiti rd kaydına yükleyen en kısa talimat dizisini üretir.
+ * 12-bit sabitler tek ADDI, alt 12 biti sıfır olanlar tek LUI, diğerleri LUI+ADDI ile yüklenir.
+ * ADDI sabiti işaret genişletildiğinden alt parça negatifse üst parça bir artırılır.
+ * @param sequence: Çıktı talimatları (en fazla 2).
+ * @return int: Üretilen talimat sayısı.
+ */
+int isel_constant_sequence(int32_t value, Register rd, Instruction sequence[2]);
+
+/**
+ * @brief Atama komutunun (C = A + B, MEM[0x10] = A, ...) talimatlarını seçer ve üretir.
+ */
+void isel_assignment(IselContext *context, const AST_Program *program, AST_StmtIndex index, CodeBuffer *buffer);
+
+/**
+ * @brief Koşullu atlama komutunun (if A > B goto L) talimatlarını seçer ve üretir.
+ * Karşılaştırma doğrudan tek bir dallanma talimatıyla birleştirilir; RV32I'da olmayan
+ * '>' ve '<=' operantları yer değiştirilmiş BLT/BGE ile üretilir.
+ */
+void isel_if_goto(IselContext *context, const AST_Program *program, AST_StmtIndex index, CodeBuffer *buffer);
+
+#endif // BESSAMBLY_ISEL_H
@@ -0,0 +1,193 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "layout.h"
+#include "cfg.h"   // Dallanma yardımcıları için
+#include "error.h"
+#include "utils.h" // safe_malloc için
+
+// Uzak atlamalarda (AUIPC+JALR) hedef adresin tutulduğu geçici kayıt.
+// IR üreteci T0/T1'i koşul operantları için kullanır; T2 yerleşim geçişine ayrılmıştır.
+#define LAYOUT_SCRATCH_REG R_T2
+
+#define LAYOUT_LABEL_UNDEFINED (-1)
+
+// Atlama biçimleri (yalnızca büyüme yönünde değişir)
+typedef enum {
+    JUMP_FORM_SHORT, // Bxx hedef / JAL hedef
+    JUMP_FORM_NEAR,  // B!xx +8; JAL hedef (yalnızca koşullu atlamalar)
+    JUMP_FORM_FAR    // B!xx +12; AUIPC; JALR / AUIPC; JALR
+} JumpForm;
+
+// --- Yardımcı İşlevler ---
+
+static bool is_label_jump(const Instruction *inst) {
+    return (cfg_is_branch(inst->type) || inst->type == I_JAL) && inst->label != SYMBOL_ID_NONE;
+}
+
+// B-Type: 13-bit işaretli ofset (±4 KiB), J-Type: 21-bit işaretli ofset (±1 MiB)
+static bool fits_branch_offset(int64_t offset) {
+    return offset >= -4096 && offset <= 4094;
+}
+
+static bool fits_jal_offset(int64_t offset) {
+    return offset >= -1048576 && offset <= 1048574;
+}
+
+/**
+ * @brief Talimatın seçilen biçimdeki boyutunu (bayt) döndürür.
+ */
+static int64_t instruction_size(const Instruction *inst, JumpForm form) {
+    if (inst->type == I_A_LABEL) return 0;
+    if (!is_label_jump(inst)) return 4;
+    if (cfg_is_branch(inst->type)) return 4 * (int64_t)(form + 1); // 4, 8, 12
+    return form == JUMP_FORM_SHORT ? 4 : 8;                    // JAL veya AUIPC+JALR
+}
+
+/**
+ * @brief Atlamanın mevcut biçimiyle hedefe erişip erişemediğini kontrol eder.
+ */
+static bool jump_form_fits(const Instruction *inst, JumpForm form, int64_t address, int64_t target) {
+    if (form == JUMP_FORM_FAR) return true; // AUIPC+JALR tüm 32-bit adres alanına erişir
+    if (inst->type == I_JAL) return fits_jal_offset(target - address);
+    if (form == JUMP_FORM_SHORT) return fits_branch_offset(target - address);
+    return fits_jal_offset(target - (address + 4)); // NEAR: JAL, ters dallanmadan sonra
+}
+
+/**
+ * @brief 32-bit PC-göreli ofseti AUIPC (üst 20 bit) ve JALR (alt 12 bit, işaretli) parçalarına böler.
+ */
+static void split_far_offset(int64_t offset, int32_t *hi, int32_t *lo) {
+    int32_t value = (int32_t)offset;
+    *hi = (int32_t)(((uint32_t)value + 0x800u) >> 12);
+    *lo = (int32_t)((uint32_t)value - ((uint32_t)*hi << 12));
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+bool layout_code(CodeBuffer *buffer, SymbolTable *sym_table) {
+    size_t count = buffer->count;
+    Instruction *instructions = buffer->instructions;
+
+    // Yardımcı rutin çağrıları dönüş adresini T2'ye yazan atlamalardır (JAL t2, rutin);
+    // uzak biçimde AUIPC t2; JALR t2, lo(t2) olur ve JALR hedefi t2'yi yazmadan önce okur.
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].type == I_A_CALL) instructions[i].type = I_JAL;
+    }
+
+    // Etiket kimliklerinin üst sınırı (etiket adres tablosunun boyutu)
+    SymbolId max_label = SYMBOL_ID_NONE;
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].label > max_label) max_label = instructions[i].label;
+    }
+
+    int64_t *label_address = (int64_t *)safe_malloc(((size_t)max_label + 1) * sizeof(int64_t));
+    int64_t *address = (int64_t *)safe_malloc((count + 1) * sizeof(int64_t));
+    uint8_t *form = (uint8_t *)safe_malloc(count + 1);
+    memset(form, JUMP_FORM_SHORT, count + 1);
+
+    // 1. Gevşetme döngüsü: Tüm atlamalar en kısa biçimle başlar; hedefe erişemeyenler
+    // bir sonraki biçime büyütülür ve adresler yeniden hesaplanır.
+    int iterations = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        iterations++;
+
+        for (SymbolId id = 0; id <= max_label; id++) label_address[id] = LAYOUT_LABEL_UNDEFINED;
+
+        int64_t pc = 0;
+        for (size_t i = 0; i < count; i++) {
+            address[i] = pc;
+            if (instructions[i].type == I_A_LABEL) {
+                label_address[instructions[i].label] = pc;
+            }
+            pc += instruction_size(&instructions[i], (JumpForm)form[i]);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            if (!is_label_jump(&instructions[i])) continue;
+
+            int64_t target = label_address[instructions[i].label];
+            if (target == LAYOUT_LABEL_UNDEFINED) {
+                // Anlambilim analizi tanımsız etiketleri yakalar; buraya ulaşılmamalıdır.
+                report_error(ERR_SEMANTIC_UNKNOWN_LABEL, 0, "Atlama hedefi yerleşim sırasında bulunamadı.");
+                return false;
+            }
+            if (!jump_form_fits(&instructions[i], (JumpForm)form[i], address[i], target)) {
+                // Koşulsuz atlamalarda NEAR biçimi yoktur (JAL zaten en uzun tek talimattır)
+                form[i] = (instructions[i].type == I_JAL) ? JUMP_FORM_FAR : form[i] + 1;
+                changed = true;
+            }
+        }
+    }
+
+    // 2. Etiket adreslerini Sembol Tablosuna yaz (talimat doğruluğunda bayt adresi)
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].type == I_A_LABEL) {
+            symtable_set_address(sym_table, instructions[i].label, label_address[instructions[i].label]);
+        }
+    }
+
+    // 3. Arabelleği son talimatlarla yeniden yaz
+    size_t final_count = 0;
+    size_t short_jumps = 0, relaxed_jumps = 0;
+    for (size_t i = 0; i < count; i++) {
+        final_count += (size_t)(instruction_size(&instructions[i], (JumpForm)form[i]) / 4);
+    }
+
+    Instruction *out = (Instruction *)safe_malloc((final_count + 1) * sizeof(Instruction));
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        const Instruction *inst = &instructions[i];
+        if (inst->type == I_A_LABEL) continue;
+        if (!is_label_jump(inst)) {
+            out[n++] = *inst;
+            continue;
+        }
+
+        int64_t target = label_address[inst->label];
+        int64_t pc = address[i];
+        int32_t hi, lo;
+
+        if (form[i] == JUMP_FORM_SHORT) {
+            out[n] = *inst;
+            out[n].immediate = (int32_t)(target - pc);
+            out[n].label = SYMBOL_ID_NONE;
+            n++;
+            short_jumps++;
+            continue;
+        }
+        relaxed_jumps++;
+
+        if (cfg_is_branch(inst->type)) {
+            // Ters koşulla uzun atlama dizisinin üzerinden geç
+            int32_t skip = (form[i] == JUMP_FORM_NEAR) ? 8 : 12;
+            out[n++] = (Instruction){cfg_invert_branch(inst->type), R_ZERO, inst->rs1, inst->rs2, skip, SYMBOL_ID_NONE};
+            pc += 4;
+            if (form[i] == JUMP_FORM_NEAR) {
+                out[n++] = (Instruction){I_JAL, R_ZERO, R_ZERO, R_ZERO, (int32_t)(target - pc), SYMBOL_ID_NONE};
+                continue;
+            }
+        }
+
+        // AUIPC t2, hi; JALR rd, lo(t2)
+        split_far_offset(target - pc, &hi, &lo);
+        out[n++] = (Instruction){I_AUIPC, LAYOUT_SCRATCH_REG, R_ZERO, R_ZERO, hi, SYMBOL_ID_NONE};
+        out[n++] = (Instruction){I_JALR, inst->rd, LAYOUT_SCRATCH_REG, R_ZERO, lo, SYMBOL_ID_NONE};
+    }
+
+    free(buffer->instructions);
+    buffer->instructions = out;
+    buffer->count = n;
+    buffer->capacity = final_count + 1;
+
+    free(form);
+    free(address);
+    free(label_address);
+
+    printf("Yerleşim: %zu talimat, %zu kısa / %zu genişletilmiş atlama (%d gevşetme turu).\n",
+           n, short_jumps, relaxed_jumps, iterations);
+    return true;
+}
@@ -0,0 +1,27 @@
+#ifndef BESSAMBLY_LAYOUT_H
+#define BESSAMBLY_LAYOUT_H
+
+#include <stdbool.h>
+#include "ir_generator.h"  // CodeBuffer ve Instruction yapıları için
+#include "symbol_table.h"  // Etiket adresleri için
+
+/**
+ * @brief Kod yerleşimi (layout) ve atlama gevşetme (branch relaxation) geçişi.
+ * Optimizasyondan sonra, ikilik kod yazılmadan önce çalışır:
+ * 1. Her etikete (I_A_LABEL) talimat doğruluğunda bir bayt adresi atar ve bunu
+ *    Sembol Tablosuna yazar.
+ * 2. Her atlama için hedefe erişebilen en kısa biçimi seçer:
+ *    - Bxx hedef              (4 bayt, ±4 KiB)
+ *    - B!xx +8; JAL x0, hedef (8 bayt, ±1 MiB)
+ *    - B!xx +12; AUIPC t2, hi; JALR x0, lo(t2) (12 bayt, ±2 GiB)
+ *    Koşulsuz atlamalar için JAL (4 bayt) veya AUIPC+JALR (8 bayt) seçilir.
+ *    Biçimler yalnızca büyüdüğü için döngü sonlanır.
+ * 3. Arabelleği yalnızca gerçek talimatlardan oluşacak şekilde yeniden yazar; etiketler
+ *    kaldırılır ve atlama talimatlarının immediate alanına PC-göreli ofset yazılır.
+ * @param buffer: Optimize edilmiş talimat arabelleği (yerinde güncellenir).
+ * @param sym_table: Etiketlerin bulunduğu Sembol Tablosu (adresler güncellenir).
+ * @return true: Yerleşim başarılıysa.
+ */
+bool layout_code(CodeBuffer *buffer, SymbolTable *sym_table);
+
+#endif // BESSAMBLY_LAYOUT_H
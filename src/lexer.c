@@ -1,10 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
+#include <limits.h> // LLONG_MAX için
 #include "lexer.h"
 #include "error.h" // Hata raporlama için
 #include "utils.h" // Yardımcı fonksiyonlar ve sabitler için
+#include "lexer_scan.h" // Toplu (SIMD) tarama işlevleri için
 
 // İleri hareket etmeden mevcut karakteri döndürür
 static char lexer_peek(Lexer *lexer) {
@@ -14,23 +15,101 @@ static char lexer_peek(Lexer *lexer) {
     return lexer->source_code[lexer->current_pos];
 }
 
-// Mevcut karakteri tüketir ve bir sonraki karaktere geçer
-static char lexer_advance(Lexer *lexer) {
-    char c = lexer_peek(lexer);
-    if (c != '\0') {
-        lexer->current_pos++;
-        if (c == '\n') {
-            lexer->current_line++;
-        }
+// Bir sonraki karaktere (lookahead) ileri hareket etmeden bakar
+static char lexer_peek_next(Lexer *lexer) {
+    if (lexer->current_pos + 1 >= lexer->source_length) {
+        return '\0';
     }
-    return c;
+    return lexer->source_code[lexer->current_pos + 1];
 }
 
-// Belirteçleri hızlıca karşılaştırmak için anahtar kelime kontrolü
-static TokenType check_keyword(const char *lexeme) {
-    if (strcmp(lexeme, "if") == 0) return TOKEN_KEYWORD_IF;
-    if (strcmp(lexeme, "goto") == 0) return TOKEN_KEYWORD_GOTO;
-    if (strcmp(lexeme, "MEM") == 0) return TOKEN_KEYWORD_MEM;
+// --- Derleme Zamanı Tabloları ---
+
+// Anahtar Kelime Mükemmel Özet (Perfect Hash) Tablosu
+// Bessambly anahtar kelimelerinin uzunlukları birbirinden farklıdır (if=2, MEM=3, goto=4),
+// bu nedenle (uzunluk & 3) çakışmasız bir özet fonksiyonudur. Her yuvada en fazla bir aday
+// bulunur; adayın uzunluğu ve metni tek bir memcmp ile doğrulanır.
+#define KEYWORD_MAX_LENGTH 4
+#define KEYWORD_HASH(length) ((length) & 3)
+
+typedef struct {
+    const char *text;
+    size_t length;
+    TokenType type;
+} KeywordEntry;
+
+static const KeywordEntry keyword_table[4] = {
+    [KEYWORD_HASH(4)] = { "goto", 4, TOKEN_KEYWORD_GOTO },
+    [KEYWORD_HASH(2)] = { "if",   2, TOKEN_KEYWORD_IF },
+    [KEYWORD_HASH(3)] = { "MEM",  3, TOKEN_KEYWORD_MEM },
+};
+
+// Tek Karakterli Operatör/Ayırıcı Tablosu (0: geçersiz karakter)
+// Not: TOKEN_KEYWORD_IF enum değeri 0 olduğundan, tablo "tip + 1" olarak tutulur.
+#define OP_ENTRY(type) ((uint8_t)((type) + 1))
+
+static const uint8_t single_char_token[256] = {
+    ['+'] = OP_ENTRY(TOKEN_OP_ADD),  ['-'] = OP_ENTRY(TOKEN_OP_SUB),
+    ['*'] = OP_ENTRY(TOKEN_OP_MUL),  ['/'] = OP_ENTRY(TOKEN_OP_DIV),
+    ['&'] = OP_ENTRY(TOKEN_OP_AND),  ['|'] = OP_ENTRY(TOKEN_OP_OR),
+    [':'] = OP_ENTRY(TOKEN_COLON),   ['['] = OP_ENTRY(TOKEN_LBRACKET),
+    [']'] = OP_ENTRY(TOKEN_RBRACKET),
+    ['='] = OP_ENTRY(TOKEN_OP_EQ),   ['<'] = OP_ENTRY(TOKEN_OP_LT),
+    ['>'] = OP_ENTRY(TOKEN_OP_GT),   ['!'] = OP_ENTRY(TOKEN_ERROR),
+};
+
+// Çok Karakterli Operatör DFA'sı
+// Durum, ilk karakterle seçilir; ikinci karakterin girdi sınıfına göre geçiş yapılır.
+// Geçiş sonucu TOKEN_ERROR değilse iki karakterli operatör kabul edilir.
+typedef enum {
+    OP_STATE_NONE = 0, // Tek karakterli operatör (uzatılamaz)
+    OP_STATE_EQ,       // '=' okundu
+    OP_STATE_LT,       // '<' okundu
+    OP_STATE_GT,       // '>' okundu
+    OP_STATE_BANG,     // '!' okundu
+    OP_STATE_COUNT
+} OperatorState;
+
+typedef enum {
+    OP_INPUT_OTHER = 0, // Operatörü uzatmayan herhangi bir karakter
+    OP_INPUT_EQUALS,    // '='
+    OP_INPUT_COUNT
+} OperatorInput;
+
+static const uint8_t op_start_state[256] = {
+    ['='] = OP_STATE_EQ, ['<'] = OP_STATE_LT, ['>'] = OP_STATE_GT, ['!'] = OP_STATE_BANG,
+};
+
+static const uint8_t op_input_class[256] = {
+    ['='] = OP_INPUT_EQUALS,
+};
+
+static const TokenType op_transition[OP_STATE_COUNT][OP_INPUT_COUNT] = {
+    [OP_STATE_NONE] = { TOKEN_ERROR, TOKEN_ERROR },
+    [OP_STATE_EQ]   = { TOKEN_ERROR, TOKEN_OP_EQ_EQ },  // ==
+    [OP_STATE_LT]   = { TOKEN_ERROR, TOKEN_OP_LE },     // <=
+    [OP_STATE_GT]   = { TOKEN_ERROR, TOKEN_OP_GE },     // >=
+    [OP_STATE_BANG] = { TOKEN_ERROR, TOKEN_OP_NOT_EQ }, // !=
+};
+
+// Rakam değerleri "değer + 1" olarak tutulur (0: rakam değil)
+static const uint8_t digit_value_plus_one[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5,
+    ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
+
+// Belirteçleri hızlıca karşılaştırmak için anahtar kelime kontrolü (mükemmel özet ile)
+static TokenType check_keyword(const char *text, size_t length) {
+    if (length > KEYWORD_MAX_LENGTH) {
+        return TOKEN_IDENTIFIER;
+    }
+    
+    const KeywordEntry *entry = &keyword_table[KEYWORD_HASH(length)];
+    if (entry->length == length && memcmp(text, entry->text, length) == 0) {
+        return entry->type;
+    }
     
     // Anahtar kelime değilse, basit bir tanımlayıcıdır (kayıt veya etiket)
     return TOKEN_IDENTIFIER;
@@ -39,57 +118,78 @@ static TokenType check_keyword(const char *lexeme) {
 // Sayıları (Decimal veya Hexadecimal) işler
 static void lexer_number(Lexer *lexer, Token *token) {
     char c = lexer_peek(lexer);
-    int base = 10;
+    char next_c = lexer_peek_next(lexer);
+    unsigned base = 10;
+    
+    token->start = lexer->current_pos;
     
     // Hexadecimal kontrolü: 0x veya 0X
-    if (c == '0' && (lexer_peek(lexer) == 'x' || lexer_peek(lexer) == 'X')) {
-        lexer_advance(lexer); // 0
-        lexer_advance(lexer); // x/X
+    if (c == '0' && (next_c == 'x' || next_c == 'X')) {
+        lexer->current_pos += 2; // 0x/0X ('\n' içermez)
         base = 16;
     }
     
-    // Sayısal değeri oku ve belirtece yaz
-    char *endptr;
-    token->value = strtoll(&lexer->source_code[lexer->current_pos], &endptr, base);
+    // Sayısal değeri oku ve belirtece yaz.
+    // Kaynak NULL ile sonlandırılmış olmayabileceği için strtoll yerine sınırlı bir döngü kullanılır.
+    unsigned long long value = 0;
+    bool overflow = false;
+    while (lexer->current_pos < lexer->source_length) {
+        unsigned digit = (unsigned)digit_value_plus_one[(unsigned char)lexer->source_code[lexer->current_pos]] - 1u;
+        if (digit >= base) break; // Rakam değilse (0 - 1 = UINT_MAX) veya tabanın dışındaysa dur
+        
+        if (value > (LLONG_MAX - (unsigned long long)digit) / base) {
+            overflow = true; // strtoll ile aynı davranış: LLONG_MAX'a doyur
+        } else {
+            value = value * base + digit;
+        }
+        lexer->current_pos++;
+    }
+    token->value = overflow ? LLONG_MAX : (long long int)value;
     
-    // Okunan bayt sayısını ilerlet
-    lexer->current_pos += (endptr - &lexer->source_code[lexer->current_pos]);
+    token->length = (uint32_t)(lexer->current_pos - token->start);
     token->type = TOKEN_INTEGER;
 }
 
 // Tanımlayıcıları (Etiket/Kayıt) işler
 static void lexer_identifier(Lexer *lexer, Token *token) {
     size_t start_pos = lexer->current_pos;
-    size_t length = 0;
     
-    // Geçerli tanımlayıcı karakterleri okumaya devam et
-    while (lexer_peek(lexer) != '\0' && is_valid_char(lexer_peek(lexer)) && length < MAX_LABEL_LENGTH) {
-        lexer_advance(lexer);
-        length++;
-    }
+    // Geçerli tanımlayıcı karakterlerinin sonunu toplu olarak bul.
+    // Tanımlayıcılar '\n' içermediği için satır sayacı değişmez.
+    // Lexeme kopyalanmadığı için uzunluk sınırı yoktur; kesme işlemi AST'ye yazılırken yapılır.
+    lexer->current_pos = lexer_scan_identifier_end(lexer->source_code, start_pos, lexer->source_length);
 
+    size_t length = lexer->current_pos - start_pos;
     if (length == 0) {
         // Bu durum olmamalı, çünkü is_valid_start_char zaten kontrol edildi.
         report_error(ERR_SYNTAX_INVALID_TOKEN, lexer->current_line, "Tanımlayıcı okunamadı.");
         return;
     }
 
-    // Lexeme'i kopyala ve sonlandır
-    strncpy(token->lexeme, &lexer->source_code[start_pos], length);
-    token->lexeme[length] = '\0';
+    // Lexeme aralığını kaydet
+    token->start = start_pos;
+    token->length = (uint32_t)length;
 
     // Anahtar kelime mi yoksa tanımlayıcı mı olduğunu kontrol et
-    token->type = check_keyword(token->lexeme);
+    token->type = check_keyword(&lexer->source_code[start_pos], length);
+
+    // Tanımlayıcıları isim havuzuna ekle; ayrıştırıcı ve sonraki aşamalar yalnızca kimliği kullanır
+    if (token->type == TOKEN_IDENTIFIER && lexer->interner != NULL) {
+        token->symbol_id = interner_intern(lexer->interner, &lexer->source_code[start_pos], length);
+    }
 }
 
 // --- Genel İşlev Uygulamaları ---
 
-Lexer *lexer_init(char *source_code) {
+Lexer *lexer_init(const char *source_code, size_t length) {
+    lexer_scan_init(); // CPU'ya uygun tarama uygulamasını seç (AVX2/SSE2/skaler)
+    
     Lexer *lexer = (Lexer *)safe_malloc(sizeof(Lexer));
     lexer->source_code = source_code;
-    lexer->source_length = strlen(source_code);
+    lexer->source_length = length;
     lexer->current_pos = 0;
     lexer->current_line = 1; // Genellikle satır numarası 1'den başlar
+    lexer->interner = NULL;
     return lexer;
 }
 
@@ -102,28 +202,19 @@ Token lexer_get_next_token(Lexer *lexer) {
     Token token;
     token.line = lexer->current_line;
     token.value = 0;
-    token.lexeme[0] = '\0';
+    token.length = 0;
+    token.symbol_id = SYMBOL_ID_NONE;
 
     // 1. Boşlukları ve Yorumları Atla
+    // Boşluk ve yorum aralıkları '\n' içermediği için satır sayacı burada güncellenmez;
+    // bu sayede aralıklar toplu (SIMD) olarak atlanabilir.
     while (1) {
-        char c = lexer_peek(lexer);
-
         // Boşlukları atla (newline hariç)
-        while (c != '\0' && is_whitespace(c) && c != '\n') {
-            lexer_advance(lexer);
-            c = lexer_peek(lexer);
-        }
+        lexer->current_pos = lexer_scan_skip_blanks(lexer->source_code, lexer->current_pos, lexer->source_length);
 
-        // Yorumları atla
-        if (c == '/' && lexer->source_code[lexer->current_pos + 1] == '/') {
-            // İki slash'ı da tüket
-            lexer_advance(lexer);
-            lexer_advance(lexer);
-            
-            // Satır sonuna kadar ilerle
-            while (lexer_peek(lexer) != '\0' && lexer_peek(lexer) != '\n') {
-                lexer_advance(lexer);
-            }
+        // Yorumları atla: satır sonuna kadar ilerle ('\n' tüketilmez, NEWLINE belirteci olur)
+        if (lexer_peek(lexer) == '/' && lexer_peek_next(lexer) == '/') {
+            lexer->current_pos = lexer_scan_find_newline(lexer->source_code, lexer->current_pos + 2, lexer->source_length);
             continue; // Yeniden boşluk kontrolü yap
         }
 
@@ -132,102 +223,70 @@ Token lexer_get_next_token(Lexer *lexer) {
     }
 
     // 2. Dosya Sonu Kontrolü
-    char c = lexer_advance(lexer);
-    if (c == '\0') {
+    token.start = lexer->current_pos;
+    if (lexer->current_pos >= lexer->source_length) {
         token.type = TOKEN_EOF;
         return token;
     }
     
+    unsigned char c = (unsigned char)lexer->source_code[lexer->current_pos];
+    uint8_t char_class = char_class_table[c];
+    
     // 3. Yeni Satır (Komut Sonu)
-    if (c == '\n') {
+    if (char_class & CHAR_CLASS_NEWLINE) {
+        lexer->current_pos++;
+        lexer->current_line++;
         token.type = TOKEN_NEWLINE;
-        // token.line zaten ayarlandı.
-        strcpy(token.lexeme, "\\n");
+        // token.line zaten ayarlandı, lexeme '\n' karakterinin kendisidir.
+        token.length = 1;
         return token;
     }
 
     // 4. Tanımlayıcılar (Kayıt, Etiket, Anahtar Kelime)
-    if (is_valid_start_char(c)) {
-        // Geri sar (çünkü advance ile tüketildi)
-        lexer->current_pos--; 
-        lexer->current_line = (c == '\n' ? lexer->current_line - 1 : lexer->current_line);
-        
+    if (char_class & CHAR_CLASS_IDENT_START) {
         lexer_identifier(lexer, &token);
         return token;
     }
 
     // 5. Sayılar (Tamsayılar)
-    if (isdigit((unsigned char)c)) {
-        // Geri sar (çünkü advance ile tüketildi)
-        lexer->current_pos--;
+    if (char_class & CHAR_CLASS_DIGIT) {
         lexer_number(lexer, &token);
         return token;
     }
 
-    // 6. Tek ve Çift Karakterli Operatörler/Ayırıcılar
-    token.lexeme[0] = c;
-    token.lexeme[1] = '\0';
+    // Gömülü '\0' karakteri dosya sonu olarak kabul edilir (konum ilerletilmez)
+    if (c == '\0') {
+        token.type = TOKEN_EOF;
+        return token;
+    }
+
+    // 6. Tek ve Çift Karakterli Operatörler/Ayırıcılar (Tablo tabanlı DFA)
+    lexer->current_pos++;
+    token.length = 1;
     
-    char next_c = lexer_peek(lexer);
-
-    switch (c) {
-        case '+': token.type = TOKEN_OP_ADD; break;
-        case '-': token.type = TOKEN_OP_SUB; break;
-        case '*': token.type = TOKEN_OP_MUL; break;
-        case '/': token.type = TOKEN_OP_DIV; break;
-        case '&': token.type = TOKEN_OP_AND; break;
-        case '|': token.type = TOKEN_OP_OR; break;
-        case ':': token.type = TOKEN_COLON; break;
-        case '[': token.type = TOKEN_LBRACKET; break;
-        case ']': token.type = TOKEN_RBRACKET; break;
-        
-        case '=':
-            if (next_c == '=') {
-                lexer_advance(lexer);
-                token.type = TOKEN_OP_EQ_EQ; // ==
-                strcat(token.lexeme, "=");
-            } else {
-                token.type = TOKEN_OP_EQ;    // = (Atama)
-            }
-            break;
-            
-        case '>':
-            if (next_c == '=') {
-                lexer_advance(lexer);
-                token.type = TOKEN_OP_GE;    // >=
-                strcat(token.lexeme, "=");
-            } else {
-                token.type = TOKEN_OP_GT;    // >
-            }
-            break;
-            
-        case '<':
-            if (next_c == '=') {
-                lexer_advance(lexer);
-                token.type = TOKEN_OP_LE;    // <=
-                strcat(token.lexeme, "=");
-            } else {
-                token.type = TOKEN_OP_LT;    // <
-            }
-            break;
-            
-        case '!':
-            if (next_c == '=') {
-                lexer_advance(lexer);
-                token.type = TOKEN_OP_NOT_EQ; // !=
-                strcat(token.lexeme, "=");
-            } else {
-                // Sadece '!' karakteri Bessambly'de geçerli bir belirteç değildir.
-                report_error(ERR_SYNTAX_INVALID_TOKEN, token.line, "Tek başına '!' geçersiz.");
-                token.type = TOKEN_ERROR;
-            }
-            break;
-
-        default:
-            // Tanımlanmamış karakter
-            report_error(ERR_SYNTAX_INVALID_TOKEN, token.line, "Bilinmeyen karakter.");
-            token.type = TOKEN_ERROR;
-            break;
+    if (!(char_class & CHAR_CLASS_OPERATOR)) {
+        // Tanımlanmamış karakter
+        report_error(ERR_SYNTAX_INVALID_TOKEN, token.line, "Bilinmeyen karakter.");
+        token.type = TOKEN_ERROR;
+        return token;
+    }
+
+    token.type = (TokenType)(single_char_token[c] - 1);
+    
+    OperatorState state = (OperatorState)op_start_state[c];
+    if (state != OP_STATE_NONE) {
+        OperatorInput input = (OperatorInput)op_input_class[(unsigned char)lexer_peek(lexer)];
+        TokenType extended = op_transition[state][input];
+        if (extended != TOKEN_ERROR) {
+            lexer->current_pos++;
+            token.type = extended;
+            token.length = 2;
+        }
+    }
+
+    if (token.type == TOKEN_ERROR) {
+        // Sadece '!' karakteri Bessambly'de geçerli bir belirteç değildir.
+        report_error(ERR_SYNTAX_INVALID_TOKEN, token.line, "Tek başına '!' geçersiz.");
     }
 
     return token;
@@ -1,8 +1,10 @@
 #ifndef BESSAMBLY_LEXER_H
 #define BESSAMBLY_LEXER_H
 
-#include <stddef.h> // size_t için
-#include "utils.h"  // MAX_LINE_LENGTH için
+#include <stddef.h>  // size_t için
+#include <stdint.h>  // uint32_t için
+#include <stdbool.h> // bool için
+#include "interner.h" // Tanımlayıcı kimlikleri için
 
 // Bessambly Dilindeki Tüm Belirteç Tipleri
 typedef enum {
@@ -41,31 +43,35 @@ typedef enum {
     
 } TokenType;
 
-// Belirteç Yapısı
+// Belirteç Yapısı (Sabit boyutlu, 32 bayt)
+// Lexeme kopyalanmaz; belirteç kaynak kod içindeki bir aralığı (span) gösterir.
+// Metne erişmek için lexer_token_text kullanılmalıdır.
 typedef struct {
-    TokenType type;                   // Belirteç tipi
-    char lexeme[MAX_LINE_LENGTH + 1]; // Kaynak koddaki belirtecin metin değeri (lexeme)
-    int line;                         // Belirtecin bulunduğu satır numarası
-    
-    // Değerler için (eğer belirteç bir sayı ise)
-    long long int value;
+    size_t start;        // Lexeme'in Lexer::source_code içindeki başlangıç ofseti
+    long long int value; // Değerler için (eğer belirteç bir sayı ise)
+    TokenType type;      // Belirteç tipi
+    uint32_t length;     // Lexeme uzunluğu (bayt)
+    int line;            // Belirtecin bulunduğu satır numarası
+    SymbolId symbol_id;  // TOKEN_IDENTIFIER: İsim havuzundaki kimlik (havuz yoksa SYMBOL_ID_NONE)
 } Token;
 
 // Lexer Durum Yapısı (Dosya okuma bağlamını tutar)
 typedef struct {
-    char *source_code;    // Kaynak kodun tamamı
-    size_t source_length; // Kaynak kodun uzunluğu
+    const char *source_code; // Kaynak kodun tamamı (NULL ile sonlandırılmış olması gerekmez)
+    size_t source_length;    // Kaynak kodun uzunluğu
     size_t current_pos;   // Şu an işlenen karakterin konumu
     int current_line;     // Şu an işlenen satır numarası
+    Interner *interner;   // Tanımlayıcıların eklendiği isim havuzu (NULL: isimler eklenmez)
 } Lexer;
 
 
 /**
  * @brief Lexer yapısını başlatır.
- * @param source_code: Bellekteki Bessambly kaynak kodunun işaretçisi.
+ * @param source_code: Bellekteki Bessambly kaynak kodunun işaretçisi (salt okunur eşleme olabilir).
+ * @param length: Kaynak kodun bayt cinsinden uzunluğu. Lexer bu sınırın ötesini okumaz.
  * @return Lexer*: Başlatılmış Lexer yapısının işaretçisi.
  */
-Lexer *lexer_init(char *source_code);
+Lexer *lexer_init(const char *source_code, size_t length);
 
 /**
  * @brief Sonraki belirteci okur ve döndürür.
@@ -74,6 +80,14 @@ Lexer *lexer_init(char *source_code);
  */
 Token lexer_get_next_token(Lexer *lexer);
 
+/**
+ * @brief Belirtecin kaynak koddaki metnine işaretçi döndürür (NULL ile sonlandırılmamıştır).
+ * Uzunluk için token->length kullanılmalıdır.
+ */
+static inline const char *lexer_token_text(const Lexer *lexer, const Token *token) {
+    return lexer->source_code + token->start;
+}
+
 /**
  * @brief Lexer tarafından kullanılan belleği serbest bırakır (kaynak kod hariç).
  * @param lexer: Lexer yapısının işaretçisi.
@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h> // pthread_once için
+#include "lexer_scan.h"
+#include "utils.h" // char_class_table için
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define LEXER_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+// Tarama uygulamalarının ortak arayüzü (çalışma zamanı seçimi için)
+typedef struct {
+    const char *name;
+    size_t (*skip_blanks)(const char *data, size_t pos, size_t end);
+    size_t (*find_newline)(const char *data, size_t pos, size_t end);
+    size_t (*identifier_end)(const char *data, size_t pos, size_t end);
+    size_t (*count_newlines)(const char *data, size_t length);
+} LexerScanOps;
+
+// --- Skaler Yedek Uygulama ---
+
+static size_t scalar_skip_blanks(const char *data, size_t pos, size_t end) {
+    while (pos < end && CHAR_HAS_CLASS(data[pos], CHAR_CLASS_BLANK)) pos++;
+    return pos;
+}
+
+static size_t scalar_find_newline(const char *data, size_t pos, size_t end) {
+    const char *found = (const char *)memchr(data + pos, '\n', end - pos);
+    return found != NULL ? (size_t)(found - data) : end;
+}
+
+static size_t scalar_identifier_end(const char *data, size_t pos, size_t end) {
+    while (pos < end && CHAR_HAS_CLASS(data[pos], CHAR_CLASS_IDENT)) pos++;
+    return pos;
+}
+
+static size_t scalar_count_newlines(const char *data, size_t length) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) {
+        count += (data[i] == '\n');
+    }
+    return count;
+}
+
+static const LexerScanOps scalar_ops = {
+    "scalar",
+    scalar_skip_blanks,
+    scalar_find_newline,
+    scalar_identifier_end,
+    scalar_count_newlines
+};
+
+#ifdef LEXER_SCAN_X86
+
+// --- SSE2 Uygulaması (16 bayt) ---
+// İşaretsiz aralık kontrolü: (c - lo) <= span  <=>  min_epu8(c - lo, span) == c - lo
+
+static inline int sse2_blank_mask(__m128i v) {
+    __m128i is_space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    __m128i t = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+    __m128i in_range = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(4)), t); // '\t'..'\r'
+    __m128i is_newline = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+    return _mm_movemask_epi8(_mm_or_si128(is_space, _mm_andnot_si128(is_newline, in_range)));
+}
+
+static inline int sse2_ident_mask(__m128i v) {
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(25)), alpha);
+    __m128i digit = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i is_underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(is_alpha, is_digit), is_underscore));
+}
+
+static size_t sse2_skip_blanks(const char *data, size_t pos, size_t end) {
+    while (pos + 16 <= end) {
+        int mask = sse2_blank_mask(_mm_loadu_si128((const __m128i *)(data + pos)));
+        if (mask != 0xFFFF) {
+            return pos + (size_t)__builtin_ctz(~mask);
+        }
+        pos += 16;
+    }
+    return scalar_skip_blanks(data, pos, end);
+}
+
+static size_t sse2_find_newline(const char *data, size_t pos, size_t end) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (pos + 16 <= end) {
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(data + pos)), newline));
+        if (mask != 0) {
+            return pos + (size_t)__builtin_ctz(mask);
+        }
+        pos += 16;
+    }
+    return scalar_find_newline(data, pos, end);
+}
+
+static size_t sse2_identifier_end(const char *data, size_t pos, size_t end) {
+    while (pos + 16 <= end) {
+        int mask = sse2_ident_mask(_mm_loadu_si128((const __m128i *)(data + pos)));
+        if (mask != 0xFFFF) {
+            return pos + (size_t)__builtin_ctz(~mask);
+        }
+        pos += 16;
+    }
+    return scalar_identifier_end(data, pos, end);
+}
+
+static size_t sse2_count_newlines(const char *data, size_t length) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    size_t count = 0;
+    size_t pos = 0;
+
+    while (pos + 16 <= length) {
+        // Bayt sayaçları en fazla 255 blokta taşar; her 255 blokta bir SAD ile topla.
+        __m128i acc = _mm_setzero_si128();
+        size_t blocks = (length - pos) / 16;
+        if (blocks > 255) blocks = 255;
+        for (size_t b = 0; b < blocks; b++, pos += 16) {
+            __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(data + pos)), newline);
+            acc = _mm_sub_epi8(acc, eq); // eq = -1 (0xFF) eşleşen baytlarda
+        }
+        __m128i sums = _mm_sad_epu8(acc, _mm_setzero_si128());
+        count += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+    }
+    return count + scalar_count_newlines(data + pos, length - pos);
+}
+
+static const LexerScanOps sse2_ops = {
+    "sse2",
+    sse2_skip_blanks,
+    sse2_find_newline,
+    sse2_identifier_end,
+    sse2_count_newlines
+};
+
+// --- AVX2 Uygulaması (32 bayt) ---
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+AVX2_TARGET static inline uint32_t avx2_blank_mask(__m256i v) {
+    __m256i is_space = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+    __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    __m256i in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(4)), t);
+    __m256i is_newline = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(is_space, _mm256_andnot_si256(is_newline, in_range)));
+}
+
+AVX2_TARGET static inline uint32_t avx2_ident_mask(__m256i v) {
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(25)), alpha);
+    __m256i digit = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i is_underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(is_alpha, is_digit), is_underscore));
+}
+
+AVX2_TARGET static size_t avx2_skip_blanks(const char *data, size_t pos, size_t end) {
+    while (pos + 32 <= end) {
+        uint32_t mask = avx2_blank_mask(_mm256_loadu_si256((const __m256i *)(data + pos)));
+        if (mask != 0xFFFFFFFFu) {
+            return pos + (size_t)__builtin_ctz(~mask);
+        }
+        pos += 32;
+    }
+    return sse2_skip_blanks(data, pos, end);
+}
+
+AVX2_TARGET static size_t avx2_find_newline(const char *data, size_t pos, size_t end) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    while (pos + 32 <= end) {
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(data + pos)), newline));
+        if (mask != 0) {
+            return pos + (size_t)__builtin_ctz(mask);
+        }
+        pos += 32;
+    }
+    return sse2_find_newline(data, pos, end);
+}
+
+AVX2_TARGET static size_t avx2_identifier_end(const char *data, size_t pos, size_t end) {
+    while (pos + 32 <= end) {
+        uint32_t mask = avx2_ident_mask(_mm256_loadu_si256((const __m256i *)(data + pos)));
+        if (mask != 0xFFFFFFFFu) {
+            return pos + (size_t)__builtin_ctz(~mask);
+        }
+        pos += 32;
+    }
+    return sse2_identifier_end(data, pos, end);
+}
+
+AVX2_TARGET static size_t avx2_count_newlines(const char *data, size_t length) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    __m256i total = _mm256_setzero_si256();
+    size_t pos = 0;
+
+    while (pos + 32 <= length) {
+        __m256i acc = _mm256_setzero_si256();
+        size_t blocks = (length - pos) / 32;
+        if (blocks > 255) blocks = 255;
+        for (size_t b = 0; b < blocks; b++, pos += 32) {
+            __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(data + pos)), newline);
+            acc = _mm256_sub_epi8(acc, eq);
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(acc, _mm256_setzero_si256()));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    size_t count = (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    return count + sse2_count_newlines(data + pos, length - pos);
+}
+
+static const LexerScanOps avx2_ops = {
+    "avx2",
+    avx2_skip_blanks,
+    avx2_find_newline,
+    avx2_identifier_end,
+    avx2_count_newlines
+};
+
+#endif // LEXER_SCAN_X86
+
+// --- Çalışma Zamanı Seçimi ---
+
+static const LexerScanOps *scan_ops = &scalar_ops;
+static pthread_once_t scan_init_once = PTHREAD_ONCE_INIT;
+
+static void lexer_scan_select(void) {
+#ifdef LEXER_SCAN_X86
+    __builtin_cpu_init();
+    if (getenv("BESSAMBLY_NO_SIMD") != NULL) {
+        scan_ops = &scalar_ops; // Hata ayıklama ve karşılaştırma için SIMD'yi kapat
+    } else if (__builtin_cpu_supports("avx2")) {
+        scan_ops = &avx2_ops;
+    } else if (__builtin_cpu_supports("sse2")) {
+        scan_ops = &sse2_ops;
+    }
+#endif
+}
+
+void lexer_scan_init(void) {
+    // Paralel ön uçta birden fazla iş parçacığı aynı anda Lexer başlatabilir
+    pthread_once(&scan_init_once, lexer_scan_select);
+}
+
+const char *lexer_scan_impl_name(void) {
+    return scan_ops->name;
+}
+
+size_t lexer_scan_skip_blanks(const char *data, size_t pos, size_t end) {
+    return scan_ops->skip_blanks(data, pos, end);
+}
+
+size_t lexer_scan_find_newline(const char *data, size_t pos, size_t end) {
+    return scan_ops->find_newline(data, pos, end);
+}
+
+size_t lexer_scan_identifier_end(const char *data, size_t pos, size_t end) {
+    return scan_ops->identifier_end(data, pos, end);
+}
+
+size_t lexer_scan_count_newlines(const char *data, size_t length) {
+    return scan_ops->count_newlines(data, length);
+}
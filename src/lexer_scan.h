@@ -0,0 +1,46 @@
+#ifndef BESSAMBLY_LEXER_SCAN_H
+#define BESSAMBLY_LEXER_SCAN_H
+
+#include <stddef.h> // size_t için
+
+// Lexer'ın sıcak döngüleri için toplu (16-32 bayt) tarama işlevleri.
+// x86 üzerinde çalışma zamanında CPU yeteneğine göre AVX2 veya SSE2 yolu seçilir,
+// diğer mimarilerde skaler yedek (fallback) kullanılır.
+// Tüm işlevler [pos, end) aralığının dışını asla okumaz (mmap edilmiş girişler için güvenli).
+
+/**
+ * @brief CPU yeteneklerini algılar ve uygun tarama uygulamasını seçer.
+ * Birden fazla kez ve birden fazla iş parçacığından güvenle çağrılabilir (seçim bir kez yapılır).
+ */
+void lexer_scan_init(void);
+
+/**
+ * @brief Seçilen tarama uygulamasının adını döndürür ("avx2", "sse2" veya "scalar").
+ */
+const char *lexer_scan_impl_name(void);
+
+/**
+ * @brief Satır sonu hariç boşluk karakterlerini (' ', '\t', '\r', '\v', '\f') atlar.
+ * @return size_t: İlk boşluk olmayan karakterin konumu veya end.
+ */
+size_t lexer_scan_skip_blanks(const char *data, size_t pos, size_t end);
+
+/**
+ * @brief Bir sonraki '\n' karakterini bulur (yorum satırlarını atlamak için).
+ * @return size_t: '\n' karakterinin konumu veya end.
+ */
+size_t lexer_scan_find_newline(const char *data, size_t pos, size_t end);
+
+/**
+ * @brief Tanımlayıcı karakterlerinin ([A-Za-z0-9_]) bittiği konumu bulur.
+ * @return size_t: İlk tanımlayıcı olmayan karakterin konumu veya end.
+ */
+size_t lexer_scan_identifier_end(const char *data, size_t pos, size_t end);
+
+/**
+ * @brief Verilen aralıktaki '\n' karakterlerini sayar.
+ * @return size_t: Satır sonu sayısı.
+ */
+size_t lexer_scan_count_newlines(const char *data, size_t length);
+
+#endif // BESSAMBLY_LEXER_SCAN_H
@@ -6,69 +6,41 @@
 // Derleyici Bileşenleri
 #include "error.h"             // Hata Yönetimi
 #include "utils.h"             // Yardımcı Fonksiyonlar (safe_malloc vb.)
-#include "lexer.h"             // Belirteçleyici
-#include "parser.h"            // Ayrıştırıcı
+#include "source_file.h"       // Kaynak Dosya Girişi (mmap / akış)
+#include "frontend.h"          // Ön Uç (Lexer + Parser, seri veya paralel)
+#include "lexer_scan.h"        // Seçilen tarama uygulamasının adı için
 #include "ast.h"               // Soyut Sözdizimi Ağacı
 #include "symbol_table.h"      // Sembol Tablosu
 #include "semantic_analyzer.h" // Anlambilim Analizi
 #include "ir_generator.h"      // RISC-V Talimat Üretimi
 #include "optimizer.h"         // Kod Optimizasyonu
+#include "regalloc.h"          // Kayıt Ataması
+#include "layout.h"            // Kod Yerleşimi ve Atlama Gevşetme
 
 // Hedefe Özgü Kod Üreticiler
 #include "codegen/unix/codegen.h"       // UNIX için
 #include "codegen/baremetal/codegen.h"  // Bare-Metal için
 
 
-// --- 1. Yardımcı Fonksiyon: Dosyayı Belleğe Oku ---
-
-/**
- * @brief Giriş dosyasının tüm içeriğini belleğe okur.
- * @param filename: Okunacak dosya yolu.
- * @return char*: Dosya içeriği (NULL ile sonlandırılmış), hata durumunda NULL.
- */
-static char *read_source_file(const char *filename) {
-    FILE *fp = fopen(filename, "r");
-    if (fp == NULL) {
-        fprintf(stderr, "HATA: Giriş dosyası açılamadı: %s\n", filename);
-        return NULL;
-    }
-
-    // Dosya boyutunu bul
-    fseek(fp, 0, SEEK_END);
-    long length = ftell(fp);
-    fseek(fp, 0, SEEK_SET);
-
-    // Bellek tahsisi (uzunluk + 1 (null sonlandırıcı için))
-    char *buffer = (char *)safe_malloc(length + 1);
-    
-    // İçeriği oku
-    size_t read_bytes = fread(buffer, 1, length, fp);
-    if (read_bytes != (size_t)length) {
-        fprintf(stderr, "HATA: Dosya okuma hatası: %s\n", filename);
-        free(buffer);
-        fclose(fp);
-        return NULL;
-    }
-
-    buffer[length] = '\0'; // Null sonlandırma
-    fclose(fp);
-    return buffer;
-}
-
-
-// --- 2. Yardımcı Fonksiyon: Kullanım Kılavuzu ---
+// --- 1. Yardımcı Fonksiyon: Kullanım Kılavuzu ---
 
 static void print_usage(const char *prog_name) {
     fprintf(stderr, "Kullanım: %s <giriş_dosyası> [seçenekler]\n", prog_name);
+    fprintf(stderr, "  (Giriş dosyası olarak '-' verilirse kaynak kod standart girişten okunur)\n");
     fprintf(stderr, "\nSeçenekler:\n");
     fprintf(stderr, "  -o <dosya>        Çıktı dosyasının adını belirtir (Varsayılan: a.out)\n");
     fprintf(stderr, "  -O<seviye>        Optimizasyon seviyesi (örn: -O1, -O2, -O3, -Ofast, -Oz)\n");
     fprintf(stderr, "  -target <platform> Hedef platform (unix veya baremetal) (Varsayılan: unix)\n");
+    fprintf(stderr, "  -march=<küme>     Hedef komut kümesi: rv32im veya rv32i (çarpma/bölme yazılımla) (Varsayılan: rv32im)\n");
+    fprintf(stderr, "  -j <N>            Ön ucu N iş parçacığıyla paralel çalıştırır (0: CPU sayısı) (Varsayılan: 1)\n");
+    fprintf(stderr, "  -single-pass      Anlambilim analizi ve kod üretimini AST üzerinde tek geçişte yapar\n");
+    fprintf(stderr, "  -regalloc <tür>   Kayıt atayıcıyı seçer: fixed, linear veya graph (Varsayılan: seviyeye göre)\n");
+    fprintf(stderr, "  -volatile <a>[-<b>] MEM[a..b] bölgesini uçucu (örn. G/Ç) işaretler; erişimleri optimize edilmez (tekrarlanabilir)\n");
     fprintf(stderr, "\nDesteklenen Optimizasyon Seviyeleri:\n");
     fprintf(stderr, "  -O0 (Kapalı), -O1, -O2, -O3, -Ofast, -Oflash, -Os, -Oz, -Onano\n");
 }
 
-// --- 3. Ana Fonksiyon: Komut Satırı Argümanlarını İşleme ve Derleme ---
+// --- 2. Ana Fonksiyon: Komut Satırı Argümanlarını İşleme ve Derleme ---
 
 int main(int argc, char *argv[]) {
     // Varsayılan Ayarlar
@@ -76,6 +48,12 @@ int main(int argc, char *argv[]) {
     const char *output_filename = "a.out";
     OptimizationLevel opt_level = O_LEVEL_O0;
     const char *target_platform = "unix";
+    int frontend_jobs = 1;
+    bool single_pass = false;
+    const char *regalloc_name = NULL; // NULL: Optimizasyon seviyesine göre seçilir
+    TargetIsa target_isa = ISA_RV32IM;
+    MemoryRegion *volatile_regions = NULL; // -volatile ile bildirilen bölgeler
+    size_t volatile_count = 0;
     
     // Argümanları İşle
     if (argc < 2) {
@@ -117,6 +95,67 @@ int main(int argc, char *argv[]) {
                 fprintf(stderr, "HATA: '-target' seçeneği platform adı gerektirir.\n");
                 return 1;
             }
+        } else if (strncmp(argv[i], "-march=", 7) == 0) {
+            const char *isa_str = argv[i] + 7;
+            if (strcmp(isa_str, "rv32im") == 0) target_isa = ISA_RV32IM;
+            else if (strcmp(isa_str, "rv32i") == 0) target_isa = ISA_RV32I;
+            else {
+                fprintf(stderr, "HATA: Desteklenmeyen komut kümesi: %s ('rv32im' veya 'rv32i' olmalıdır).\n", isa_str);
+                return 1;
+            }
+        } else if (strncmp(argv[i], "-j", 2) == 0) {
+            // Hem "-j N" hem de "-jN" biçimi desteklenir
+            const char *jobs_str = argv[i] + 2;
+            if (jobs_str[0] == '\0') {
+                if (i + 1 >= argc) {
+                    fprintf(stderr, "HATA: '-j' seçeneği iş parçacığı sayısı gerektirir.\n");
+                    return 1;
+                }
+                jobs_str = argv[++i];
+            }
+            char *endptr;
+            long jobs = strtol(jobs_str, &endptr, 10);
+            if (*endptr != '\0' || jobs < 0) {
+                fprintf(stderr, "HATA: Geçersiz iş parçacığı sayısı: %s\n", jobs_str);
+                return 1;
+            }
+            frontend_jobs = (int)jobs;
+        } else if (strcmp(argv[i], "-single-pass") == 0) {
+            single_pass = true;
+        } else if (strcmp(argv[i], "-regalloc") == 0) {
+            if (i + 1 < argc) {
+                regalloc_name = argv[++i];
+                if (strcmp(regalloc_name, "fixed") != 0 && strcmp(regalloc_name, "linear") != 0 &&
+                    strcmp(regalloc_name, "graph") != 0) {
+                    fprintf(stderr, "HATA: Desteklenmeyen kayıt atayıcı. 'fixed', 'linear' veya 'graph' olmalıdır.\n");
+                    return 1;
+                }
+            } else {
+                fprintf(stderr, "HATA: '-regalloc' seçeneği atayıcı adı gerektirir.\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-volatile") == 0) {
+            // "<başlangıç>" (tek kelime) veya "<başlangıç>-<bitiş>" (iki uç dahil); onluk veya 0x onaltılık
+            if (i + 1 >= argc) {
+                fprintf(stderr, "HATA: '-volatile' seçeneği adres aralığı gerektirir.\n");
+                return 1;
+            }
+            const char *range_str = argv[++i];
+            char *endptr;
+            errno = 0;
+            unsigned long start = strtoul(range_str, &endptr, 0);
+            unsigned long end = start + 3;
+            if (endptr != range_str && *endptr == '-') {
+                const char *end_str = endptr + 1;
+                end = strtoul(end_str, &endptr, 0);
+                if (endptr == end_str) endptr = (char *)range_str; // Bitiş eksik
+            }
+            if (endptr == range_str || *endptr != '\0' || errno != 0 || end < start || end > UINT32_MAX) {
+                fprintf(stderr, "HATA: Geçersiz uçucu bellek aralığı: %s\n", range_str);
+                return 1;
+            }
+            volatile_regions = (MemoryRegion *)safe_realloc(volatile_regions, (volatile_count + 1) * sizeof(MemoryRegion));
+            volatile_regions[volatile_count++] = (MemoryRegion){(uint32_t)start, (uint32_t)end};
         } else if (input_filename == NULL) {
             input_filename = argv[i];
         } else {
@@ -132,8 +171,8 @@ int main(int argc, char *argv[]) {
 
     // --- Derleme Akışı Başlangıcı ---
     
-    char *source_code = read_source_file(input_filename);
-    if (source_code == NULL) {
+    SourceFile *source = source_file_open(input_filename);
+    if (source == NULL) {
         return 1;
     }
 
@@ -141,36 +180,41 @@ int main(int argc, char *argv[]) {
     printf("Giriş: %s, Çıktı: %s, Opt: -O%s, Hedef: %s\n", 
            input_filename, output_filename, argv[argc - (strcmp(argv[argc - 1], "fast") == 0 ? 1 : 1)], target_platform); // Basitleştirilmiş opt. seviyesi gösterimi
     
-    // 1. Lexer (Belirteçleyici) Aşaması
-    Lexer *lexer = lexer_init(source_code);
-    Parser *parser = NULL;
     AST_Program *ast = NULL;
     SymbolTable *sym_table = symtable_init();
     CodeBuffer *riscv_code = NULL;
     int return_code = 0;
     
-    // 2. Parser (Ayrıştırıcı) Aşaması
-    parser = parser_init(lexer);
-    printf("Parser Aşaması Başladı...\n");
-    ast = parser_parse_program(parser);
+    // 1-2. Lexer (Belirteçleyici) ve Parser (Ayrıştırıcı) Aşamaları
+    lexer_scan_init(); // Tarama uygulaması (AVX2/SSE2/skaler) CPU'ya göre bir kez seçilir
+    printf("Parser Aşaması Başladı (tarama: %s)...\n", lexer_scan_impl_name());
+    ast = frontend_parse(source->data, source->length, frontend_jobs);
     
     if (ast == NULL) {
         fprintf(stderr, "DERLEME HATA: Sözdizimi hataları nedeniyle durduruldu.\n");
         return_code = 1;
         goto cleanup;
     }
+    
+    printf("AST: %u komut, %zu KiB bellek (arena).\n",
+           ast->statement_count, ast_program_footprint(ast) / 1024);
 
     // ast_print(ast); // DEBUG: AST'yi Yazdır
 
-    // 3. Semantic Analyzer (Anlambilim Çözümleyici) Aşaması
-    if (!analyze_semantic(ast, sym_table)) {
-        fprintf(stderr, "DERLEME HATA: Anlambilim hataları nedeniyle durduruldu.\n");
-        return_code = 1;
-        goto cleanup;
-    }
+    if (single_pass) {
+        // 3-4. Anlambilim Analizi ve Kod Üretimi (AST üzerinde tek geçiş)
+        riscv_code = generate_riscv_code_single_pass(ast, sym_table, target_isa);
+    } else {
+        // 3. Semantic Analyzer (Anlambilim Çözümleyici) Aşaması
+        if (!analyze_semantic(ast, sym_table)) {
+            fprintf(stderr, "DERLEME HATA: Anlambilim hataları nedeniyle durduruldu.\n");
+            return_code = 1;
+            goto cleanup;
+        }
 
-    // 4. IR Generator (Kod Üretimi) Aşaması
-    riscv_code = generate_riscv_code(ast, sym_table);
+        // 4. IR Generator (Kod Üretimi) Aşaması
+        riscv_code = generate_riscv_code(ast, sym_table, target_isa);
+    }
     if (riscv_code == NULL) {
         fprintf(stderr, "DERLEME HATA: Kod üretimi başarısız oldu.\n");
         return_code = 1;
@@ -179,7 +223,8 @@ int main(int argc, char *argv[]) {
     
     // 5. Optimizer (Optimizasyon) Aşaması
     if (opt_level != O_LEVEL_O0) {
-        if (!optimize_code(riscv_code, opt_level)) {
+        VolatileMemory volatile_memory = {volatile_regions, volatile_count};
+        if (!optimize_code(riscv_code, opt_level, &volatile_memory)) {
              fprintf(stderr, "DERLEME HATA: Optimizasyon başarısız oldu.\n");
              // Hata olsa bile devam edebiliriz, ancak güvenli bir çıkış yapalım.
              return_code = 1; 
@@ -187,6 +232,29 @@ int main(int argc, char *argv[]) {
         }
     }
     
+    // 5.1 Kayıt Ataması: Sanal kayıtlar fiziksel kayıtlara (tüm seviyelerde zorunludur)
+    OptimizationFlags opt_flags = get_optimization_flags(opt_level);
+    RegAllocStrategy regalloc_strategy = opt_flags.graph_coloring ? REGALLOC_GRAPH_COLORING
+                                       : opt_flags.register_alloc ? REGALLOC_LINEAR_SCAN
+                                       : REGALLOC_FIXED;
+    if (regalloc_name != NULL) {
+        if (strcmp(regalloc_name, "graph") == 0) regalloc_strategy = REGALLOC_GRAPH_COLORING;
+        else if (strcmp(regalloc_name, "linear") == 0) regalloc_strategy = REGALLOC_LINEAR_SCAN;
+        else regalloc_strategy = REGALLOC_FIXED;
+    }
+    if (!allocate_registers(riscv_code, regalloc_strategy)) {
+        fprintf(stderr, "DERLEME HATA: Kayıt ataması başarısız oldu.\n");
+        return_code = 1;
+        goto cleanup;
+    }
+    
+    // 5.2 Kod Yerleşimi: Etiket adresleri ve atlama biçimleri (optimizasyondan sonra)
+    if (!layout_code(riscv_code, sym_table)) {
+        fprintf(stderr, "DERLEME HATA: Kod yerleşimi başarısız oldu.\n");
+        return_code = 1;
+        goto cleanup;
+    }
+    
     // print_riscv_code(riscv_code); // DEBUG: Optimizasyon sonrası kodu yazdır
 
     // 6. Codegen (Hedefe Özgü İkilik Dosya Yazma) Aşaması
@@ -207,9 +275,8 @@ cleanup:
     if (riscv_code) code_buffer_free(riscv_code);
     if (sym_table) symtable_free(sym_table);
     if (ast) ast_program_free(ast);
-    if (parser) parser_free(parser);
-    if (lexer) lexer_free(lexer);
-    if (source_code) free(source_code);
+    if (source) source_file_close(source);
+    free(volatile_regions);
 
     if (return_code == 0) {
         printf("Tebrikler! Derleme başarılı. Çıktı dosyası: %s\n", output_filename);
@@ -0,0 +1,532 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memory_flow.h"
+#include "cfg.h"   // Temel bloklar için
+#include "utils.h" // safe_malloc için
+
+// Bir bloğun girişinde/çıkışında izlenen en fazla "kelime = kayıt" bilgisi. Sınır aşılınca yeni
+// bilgi eklenmez (bilgi düşürmek her zaman güvenlidir).
+#define MEMORY_MAX_FACTS 32
+
+// İleri analiz bu kadar turda sabitlenmezse yalnızca blok içi iletim yapılır
+#define MEMORY_MAX_ROUNDS 64
+
+// Talimat başına uygulanacak değişiklik
+typedef enum {
+    MEMORY_KEEP,
+    MEMORY_DELETE, // Ölü depo veya değeri zaten hedef kayıtta olan yükleme
+    MEMORY_COPY    // Yükleme -> ADD rd, kaynak, x0
+} MemoryAction;
+
+// "Adres kimliğindeki kelimenin değeri reg kaydındadır"
+typedef struct {
+    uint32_t address_id;
+    Register reg;
+    bool from_store; // Bilgi bir depolamadan mı (istatistik için)
+} MemoryFact;
+
+typedef struct {
+    bool top; // Henüz hesaplanmadı (kesişimde etkisiz eleman)
+    uint32_t count;
+    MemoryFact facts[MEMORY_MAX_FACTS];
+} FactSet;
+
+typedef struct {
+    const CodeBuffer *buffer;
+    const MemoryAccess *accesses;
+    const uint32_t *addresses; // Bilinen erişim adresleri (sıralı, tekrarsız) -> adres kimliği = dizin
+    uint32_t address_count;
+    uint8_t *action;
+    Register *copy_source;
+    MemoryFlowStats *stats;
+} MemoryFlowState;
+
+// --- Erişim Sınıflandırma ---
+
+static uint8_t access_size(InstructionType type) {
+    switch (type) {
+        case I_LW: case I_SW:             return 4;
+        case I_LH: case I_LHU: case I_SH: return 2;
+        case I_LB: case I_LBU: case I_SB: return 1;
+        default:                          return 0;
+    }
+}
+
+static bool is_store(InstructionType type) {
+    return type == I_SW || type == I_SH || type == I_SB;
+}
+
+static bool overlaps_volatile(const VolatileMemory *volatile_memory, uint32_t address, uint8_t size) {
+    if (volatile_memory == NULL) return false;
+    uint64_t last = (uint64_t)address + size - 1;
+    for (size_t r = 0; r < volatile_memory->count; r++) {
+        const MemoryRegion *region = &volatile_memory->regions[r];
+        if (address <= region->end && last >= region->start) return true;
+    }
+    return false;
+}
+
+void memory_flow_classify(const CodeBuffer *buffer, const VolatileMemory *volatile_memory, MemoryAccess *accesses) {
+    const Instruction *instructions = buffer->instructions;
+    size_t count = buffer->count;
+    bool any_volatile = volatile_memory != NULL && volatile_memory->count > 0;
+    static const Register call_clobbers[] = {R_T0, R_T1, R_T2, R_T5, R_T6, R_TP};
+    const size_t clobber_count = sizeof(call_clobbers) / sizeof(call_clobbers[0]);
+
+    uint32_t register_count = R_COUNT;
+    for (size_t i = 0; i < count; i++) {
+        if ((uint32_t)instructions[i].rd >= register_count) register_count = instructions[i].rd + 1;
+        if ((uint32_t)instructions[i].rs1 >= register_count) register_count = instructions[i].rs1 + 1;
+        if ((uint32_t)instructions[i].rs2 >= register_count) register_count = instructions[i].rs2 + 1;
+    }
+
+    // Giriş öneki (ilk etiketten veya atlamadan önceki düz kod) bir kez çalışır ve her şeye baskındır:
+    // Yalnızca önekte yazılan kayıtların (gp, sabit taban kayıtları) önek sonundaki değeri her yerde
+    // geçerlidir. Diğer kayıtlar blok içinde izlenir; etiketlerde bu global değerlere dönülür.
+    size_t prefix_end = 0;
+    while (prefix_end < count && instructions[prefix_end].type != I_A_LABEL &&
+           !cfg_is_terminator(instructions[prefix_end].type)) {
+        prefix_end++;
+    }
+
+    bool *written_later = (bool *)safe_malloc(register_count);
+    bool *global_known = (bool *)safe_malloc(register_count);
+    uint32_t *global_value = (uint32_t *)safe_malloc(register_count * sizeof(uint32_t));
+    bool *known = (bool *)safe_malloc(register_count);
+    uint32_t *value = (uint32_t *)safe_malloc(register_count * sizeof(uint32_t));
+    bool *is_dirty = (bool *)safe_malloc(register_count);
+    Register *dirty = (Register *)safe_malloc(register_count * sizeof(Register)); // Son etiketten beri değişenler
+    size_t dirty_count = 0;
+    memset(written_later, 0, register_count);
+    memset(global_known, 0, register_count);
+    memset(known, 0, register_count);
+    memset(is_dirty, 0, register_count);
+    known[R_ZERO] = true;
+    value[R_ZERO] = 0;
+
+    for (size_t i = prefix_end; i < count; i++) {
+        written_later[cfg_instruction_def(&instructions[i])] = true;
+        if (instructions[i].type == I_A_CALL) {
+            for (size_t c = 0; c < clobber_count; c++) written_later[call_clobbers[c]] = true;
+        }
+    }
+    written_later[R_ZERO] = false;
+
+    for (size_t i = 0; i < count; i++) {
+        const Instruction *inst = &instructions[i];
+
+        if (i == prefix_end) {
+            for (uint32_t r = 0; r < register_count; r++) {
+                global_known[r] = known[r] && !written_later[r];
+                global_value[r] = value[r];
+                known[r] = global_known[r]; // Önekten sonrasına atlamalarla da girilebilir
+            }
+        }
+        if (inst->type == I_A_LABEL && i > prefix_end) {
+            for (size_t d = 0; d < dirty_count; d++) {
+                known[dirty[d]] = global_known[dirty[d]];
+                value[dirty[d]] = global_value[dirty[d]];
+                is_dirty[dirty[d]] = false;
+            }
+            dirty_count = 0;
+        }
+
+        uint8_t size = access_size(inst->type);
+        MemoryAccess *access = &accesses[i];
+        *access = (MemoryAccess){0, size, false, false};
+        if (size > 0) {
+            access->known = known[inst->rs1];
+            access->address = access->known ? value[inst->rs1] + (uint32_t)inst->immediate : 0;
+            access->is_volatile = access->known ? overlaps_volatile(volatile_memory, access->address, size) : any_volatile;
+        }
+
+        // Yazılan kaydın yeni değeri (taban kayıtlarını yükleyen LUI/ADDI ve kopyalar)
+        Register defs[sizeof(call_clobbers) / sizeof(call_clobbers[0])];
+        size_t def_count = 0;
+        if (inst->type == I_A_CALL) {
+            for (size_t c = 0; c < clobber_count; c++) defs[def_count++] = call_clobbers[c];
+        } else if (cfg_instruction_def(inst) != R_ZERO) {
+            defs[def_count++] = cfg_instruction_def(inst);
+        }
+        for (size_t d = 0; d < def_count; d++) {
+            Register def = defs[d];
+            bool result_known = false;
+            uint32_t result = 0;
+            if (inst->type == I_LUI) {
+                result_known = true;
+                result = (uint32_t)inst->immediate << 12;
+            } else if (inst->type == I_ADDI && known[inst->rs1]) {
+                result_known = true;
+                result = value[inst->rs1] + (uint32_t)inst->immediate;
+            } else if (inst->type == I_ADD && known[inst->rs1] && known[inst->rs2]) {
+                result_known = true;
+                result = value[inst->rs1] + value[inst->rs2];
+            }
+            known[def] = result_known;
+            value[def] = result;
+            if (i >= prefix_end && !is_dirty[def]) {
+                is_dirty[def] = true;
+                dirty[dirty_count++] = def;
+            }
+        }
+    }
+
+    free(dirty);
+    free(is_dirty);
+    free(value);
+    free(known);
+    free(global_value);
+    free(global_known);
+    free(written_later);
+}
+
+// --- Adres Kimlikleri ---
+
+static int compare_addresses(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Adresi address'ten küçük olmayan ilk kimliği döndürür.
+ */
+static uint32_t lower_bound(const MemoryFlowState *state, uint64_t address) {
+    uint32_t low = 0, high = state->address_count;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (state->addresses[mid] < address) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/**
+ * @brief Erişimin dokunduğu baytlarla örtüşen kelime kimliklerinin aralığını [first, last) döndürür.
+ * (Kimlik k, [addresses[k], addresses[k] + 4) kelimesini temsil eder.)
+ */
+static void overlapping_ids(const MemoryFlowState *state, const MemoryAccess *access, uint32_t *first, uint32_t *last) {
+    uint64_t start = access->address >= 3 ? (uint64_t)access->address - 3 : 0;
+    *first = lower_bound(state, start);
+    *last = lower_bound(state, (uint64_t)access->address + access->size);
+}
+
+// Tam kelime ve uçucu olmayan, adresi bilinen erişim: Analizin bilgi ürettiği tek erişim türü
+static bool is_tracked_word(const MemoryAccess *access) {
+    return access->size == 4 && access->known && !access->is_volatile;
+}
+
+// --- İleri Analiz: Kullanılabilir Değerler (Depo-Yükleme İletimi) ---
+
+static void facts_kill_register(FactSet *set, Register reg) {
+    uint32_t n = 0;
+    for (uint32_t f = 0; f < set->count; f++) {
+        if (set->facts[f].reg != reg) set->facts[n++] = set->facts[f];
+    }
+    set->count = n;
+}
+
+static void facts_kill_range(FactSet *set, uint32_t first, uint32_t last) {
+    uint32_t n = 0;
+    for (uint32_t f = 0; f < set->count; f++) {
+        if (set->facts[f].address_id < first || set->facts[f].address_id >= last) set->facts[n++] = set->facts[f];
+    }
+    set->count = n;
+}
+
+static void facts_kill_physical(FactSet *set) {
+    uint32_t n = 0;
+    for (uint32_t f = 0; f < set->count; f++) {
+        if (set->facts[f].reg == R_ZERO || REGISTER_IS_VIRTUAL(set->facts[f].reg)) set->facts[n++] = set->facts[f];
+    }
+    set->count = n;
+}
+
+static void facts_add(FactSet *set, uint32_t address_id, Register reg, bool from_store) {
+    // Fiziksel kayıtlar (T0/T1 geçicileri) bilgi taşımaz; yaşam aralıkları uzatılmamalıdır
+    if (reg != R_ZERO && !REGISTER_IS_VIRTUAL(reg)) return;
+    if (set->count == MEMORY_MAX_FACTS) return;
+    set->facts[set->count++] = (MemoryFact){address_id, reg, from_store};
+}
+
+static const MemoryFact *facts_find(const FactSet *set, uint32_t address_id) {
+    for (uint32_t f = 0; f < set->count; f++) {
+        if (set->facts[f].address_id == address_id) return &set->facts[f];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bir talimatın bilgi kümesine etkisi. rewrite true ise yeniden okunan kelimeler için
+ * talimatın eylemi (silme/kopya) kaydedilir.
+ */
+static void forward_transfer(MemoryFlowState *state, size_t i, FactSet *set, bool rewrite) {
+    const Instruction *inst = &state->buffer->instructions[i];
+    const MemoryAccess *access = &state->accesses[i];
+
+    if (inst->type == I_A_CALL) {
+        facts_kill_physical(set);
+        return;
+    }
+    if (access->size > 0 && is_store(inst->type)) {
+        if (!access->known) {
+            set->count = 0; // Herhangi bir kelimeye yazmış olabilir
+            return;
+        }
+        uint32_t first, last;
+        overlapping_ids(state, access, &first, &last);
+        facts_kill_range(set, first, last);
+        if (is_tracked_word(access)) facts_add(set, lower_bound(state, access->address), inst->rs2, true);
+        return;
+    }
+
+    Register def = cfg_instruction_def(inst);
+    if (access->size > 0 && is_tracked_word(access)) {
+        uint32_t id = lower_bound(state, access->address);
+        const MemoryFact *fact = facts_find(set, id);
+        if (fact != NULL) {
+            Register source = fact->reg;
+            bool from_store = fact->from_store;
+            if (rewrite) {
+                state->action[i] = def == source ? MEMORY_DELETE : MEMORY_COPY;
+                state->copy_source[i] = source;
+                if (from_store) state->stats->forwarded_stores++;
+                else state->stats->redundant_loads++;
+            }
+            if (def != source) facts_kill_register(set, def);
+            return;
+        }
+        if (def != R_ZERO) {
+            facts_kill_register(set, def);
+            facts_add(set, id, def, false);
+        }
+        return;
+    }
+    if (def != R_ZERO) facts_kill_register(set, def);
+}
+
+/**
+ * @brief Öncüllerin çıkış kümelerinin kesişimi (hesaplanmamış öncüller atlanır).
+ */
+static void facts_meet(FactSet *result, const FactSet *outs, const uint32_t *preds, uint32_t pred_count) {
+    result->top = true;
+    result->count = 0;
+    for (uint32_t p = 0; p < pred_count; p++) {
+        const FactSet *out = &outs[preds[p]];
+        if (out->top) continue;
+        if (result->top) {
+            *result = *out;
+            continue;
+        }
+        uint32_t n = 0;
+        for (uint32_t f = 0; f < result->count; f++) {
+            const MemoryFact *other = facts_find(out, result->facts[f].address_id);
+            if (other != NULL && other->reg == result->facts[f].reg) result->facts[n++] = result->facts[f];
+        }
+        result->count = n;
+    }
+}
+
+static bool facts_equal(const FactSet *a, const FactSet *b) {
+    if (a->top != b->top || a->count != b->count) return false;
+    for (uint32_t f = 0; f < a->count; f++) {
+        if (a->facts[f].address_id != b->facts[f].address_id || a->facts[f].reg != b->facts[f].reg) return false;
+    }
+    return true;
+}
+
+static void forward_values(MemoryFlowState *state, const ControlFlowGraph *cfg, uint32_t **preds, const uint32_t *pred_count) {
+    size_t block_count = cfg->block_count;
+    FactSet *outs = (FactSet *)safe_malloc(block_count * sizeof(FactSet));
+    FactSet in, out;
+    for (size_t b = 0; b < block_count; b++) outs[b] = (FactSet){true, 0, {{0}}};
+
+    // Girişi olmayan bloklar (giriş, yardımcı rutinler) boş kümeyle başlar; diğerleri öncüllerden
+    bool converged = false;
+    for (int round = 0; round < MEMORY_MAX_ROUNDS && !converged; round++) {
+        converged = true;
+        for (size_t b = 0; b < block_count; b++) {
+            facts_meet(&in, outs, preds[b], pred_count[b]);
+            if (pred_count[b] == 0 || b == 0) in = (FactSet){false, 0, {{0}}};
+            if (in.top) continue; // Henüz erişilmedi
+            out = in;
+            for (size_t i = cfg->blocks[b].start; i < cfg->blocks[b].end; i++) forward_transfer(state, i, &out, false);
+            if (!facts_equal(&out, &outs[b])) {
+                outs[b] = out;
+                converged = false;
+            }
+        }
+    }
+
+    for (size_t b = 0; b < block_count; b++) {
+        facts_meet(&in, outs, preds[b], pred_count[b]);
+        if (!converged || in.top || pred_count[b] == 0 || b == 0) in = (FactSet){false, 0, {{0}}};
+        for (size_t i = cfg->blocks[b].start; i < cfg->blocks[b].end; i++) forward_transfer(state, i, &in, true);
+    }
+    free(outs);
+}
+
+// --- Geri Analiz: Okunmadan Üzerine Yazılan Kelimeler (Ölü Depo Eleme) ---
+
+/**
+ * @brief Bir talimatın "okunmadan üzerine yazılacak kelimeler" kümesine etkisi (geriye doğru).
+ */
+static void backward_transfer(MemoryFlowState *state, size_t i, uint64_t *set, size_t words, bool rewrite) {
+    const Instruction *inst = &state->buffer->instructions[i];
+    const MemoryAccess *access = &state->accesses[i];
+    if (access->size == 0 || state->action[i] != MEMORY_KEEP) return; // Kopyaya çevrilen yükleme belleği okumaz
+
+    if (is_store(inst->type)) {
+        if (!is_tracked_word(access)) return; // Uçucu/kısmi depolama ölü olamaz ve kelimeyi tamamen yazmaz
+        uint32_t id = lower_bound(state, access->address);
+        if (rewrite && CFG_SET_HAS(set, id)) {
+            state->action[i] = MEMORY_DELETE;
+            state->stats->dead_stores++;
+        }
+        CFG_SET_ADD(set, id);
+        return;
+    }
+
+    if (!access->known) {
+        memset(set, 0, words * sizeof(uint64_t)); // Herhangi bir kelimeyi okumuş olabilir
+        return;
+    }
+    uint32_t first, last;
+    overlapping_ids(state, access, &first, &last);
+    for (uint32_t id = first; id < last; id++) set[id >> 6] &= ~((uint64_t)1 << (id & 63));
+}
+
+static void eliminate_dead_stores(MemoryFlowState *state, const ControlFlowGraph *cfg) {
+    size_t block_count = cfg->block_count;
+    size_t words = (state->address_count + 63) / 64;
+    uint64_t *ins = (uint64_t *)safe_malloc((block_count * words + 1) * sizeof(uint64_t));
+    uint64_t *set = (uint64_t *)safe_malloc((words + 1) * sizeof(uint64_t));
+    memset(ins, 0xFF, block_count * words * sizeof(uint64_t)); // Henüz hesaplanmadı: Tüm kelimeler
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t b = block_count; b-- > 0;) {
+            // Çıkış: Ardılların kesişimi; ardılı olmayan blokta (HALT, JALR) bellek gözlemlenir
+            const BasicBlock *block = &cfg->blocks[b];
+            bool has_successor = false;
+            memset(set, 0xFF, words * sizeof(uint64_t));
+            for (int s = 0; s < 2; s++) {
+                if (block->successors[s] == CFG_NO_BLOCK) continue;
+                has_successor = true;
+                const uint64_t *succ_in = ins + (size_t)block->successors[s] * words;
+                for (size_t w = 0; w < words; w++) set[w] &= succ_in[w];
+            }
+            if (!has_successor) memset(set, 0, words * sizeof(uint64_t));
+
+            for (size_t i = block->end; i-- > block->start;) backward_transfer(state, i, set, words, false);
+            if (memcmp(set, ins + b * words, words * sizeof(uint64_t)) != 0) {
+                memcpy(ins + b * words, set, words * sizeof(uint64_t));
+                changed = true;
+            }
+        }
+    }
+
+    for (size_t b = 0; b < block_count; b++) {
+        const BasicBlock *block = &cfg->blocks[b];
+        bool has_successor = false;
+        memset(set, 0xFF, words * sizeof(uint64_t));
+        for (int s = 0; s < 2; s++) {
+            if (block->successors[s] == CFG_NO_BLOCK) continue;
+            has_successor = true;
+            const uint64_t *succ_in = ins + (size_t)block->successors[s] * words;
+            for (size_t w = 0; w < words; w++) set[w] &= succ_in[w];
+        }
+        if (!has_successor) memset(set, 0, words * sizeof(uint64_t));
+        for (size_t i = block->end; i-- > block->start;) backward_transfer(state, i, set, words, true);
+    }
+
+    free(set);
+    free(ins);
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+size_t memory_flow_optimize(CodeBuffer *buffer, const VolatileMemory *volatile_memory, MemoryFlowStats *stats) {
+    size_t count = buffer->count;
+    if (count == 0) return 0;
+
+    MemoryAccess *accesses = (MemoryAccess *)safe_malloc(count * sizeof(MemoryAccess));
+    memory_flow_classify(buffer, volatile_memory, accesses);
+
+    // Adres kimlikleri: Bilinen erişim adresleri sıralanır, tekrarlar atılır
+    uint32_t *addresses = (uint32_t *)safe_malloc((count + 1) * sizeof(uint32_t));
+    uint32_t address_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (accesses[i].size > 0 && accesses[i].known) addresses[address_count++] = accesses[i].address;
+    }
+    if (address_count == 0) {
+        free(addresses);
+        free(accesses);
+        return 0;
+    }
+    qsort(addresses, address_count, sizeof(uint32_t), compare_addresses);
+    uint32_t unique = 1;
+    for (uint32_t k = 1; k < address_count; k++) {
+        if (addresses[k] != addresses[unique - 1]) addresses[unique++] = addresses[k];
+    }
+
+    MemoryFlowState state = {buffer, accesses, addresses, unique, NULL, NULL, stats};
+    state.action = (uint8_t *)safe_malloc(count);
+    state.copy_source = (Register *)safe_malloc(count * sizeof(Register));
+    memset(state.action, MEMORY_KEEP, count);
+
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    uint32_t *pred_count = (uint32_t *)safe_malloc((cfg->block_count + 1) * sizeof(uint32_t));
+    uint32_t **preds = (uint32_t **)safe_malloc((cfg->block_count + 1) * sizeof(uint32_t *));
+    memset(pred_count, 0, (cfg->block_count + 1) * sizeof(uint32_t));
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        for (int s = 0; s < 2; s++) {
+            if (cfg->blocks[b].successors[s] != CFG_NO_BLOCK) pred_count[cfg->blocks[b].successors[s]]++;
+        }
+    }
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        preds[b] = (uint32_t *)safe_malloc((pred_count[b] + 1) * sizeof(uint32_t));
+        pred_count[b] = 0;
+    }
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        for (int s = 0; s < 2; s++) {
+            int succ = cfg->blocks[b].successors[s];
+            if (succ != CFG_NO_BLOCK) preds[succ][pred_count[succ]++] = (uint32_t)b;
+        }
+    }
+
+    forward_values(&state, cfg, preds, pred_count);
+    eliminate_dead_stores(&state, cfg);
+
+    size_t write_idx = 0, changes = 0;
+    for (size_t i = 0; i < count; i++) {
+        Instruction inst = buffer->instructions[i];
+        if (state.action[i] == MEMORY_DELETE) {
+            changes++;
+            continue;
+        }
+        if (state.action[i] == MEMORY_COPY) {
+            inst = (Instruction){I_ADD, inst.rd, state.copy_source[i], R_ZERO, 0, SYMBOL_ID_NONE};
+            changes++;
+        }
+        buffer->instructions[write_idx++] = inst;
+    }
+    buffer->count = write_idx;
+
+    for (size_t b = 0; b < cfg->block_count; b++) free(preds[b]);
+    free(preds);
+    free(pred_count);
+    cfg_free(cfg);
+    free(state.copy_source);
+    free(state.action);
+    free(addresses);
+    free(accesses);
+    return changes;
+}
+
+void memory_flow_print_stats(const MemoryFlowStats *stats) {
+    printf("Bellek Veri Akışı: %zu depo-yükleme iletimi, %zu gereksiz yükleme, %zu ölü depo kaldırıldı.\n",
+           stats->forwarded_stores, stats->redundant_loads, stats->dead_stores);
+}
@@ -0,0 +1,69 @@
+#ifndef BESSAMBLY_MEMORY_FLOW_H
+#define BESSAMBLY_MEMORY_FLOW_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+
+/**
+ * @brief MEM[] Veri Akışı
+ * Bessambly'de her MEM[adres] erişiminin adresi derleme zamanında bilinir: Taban kaydı x0, gp
+ * veya program girişinde bir kez yüklenen sabit taban kaydıdır (bkz. addressing.h). Bu yüzden
+ * iki erişimin aynı bayta dokunup dokunmadığı kesin olarak çözülür.
+ *
+ * İleri yönde "kullanılabilir değerler" analizi, bir bellek kelimesinin değerini hâlâ tutan
+ * kaydı izler: Depolanan değer sonraki yüklemelere kopya olarak iletilir, aynı kelimeyi tekrar
+ * okuyan yüklemeler kaldırılır. Geri yönde "okunmadan üzerine yazılan kelimeler" analizi, her
+ * yolda okunmadan önce yeniden yazılan depolamaları siler. Program bittiğinde (HALT) bellek
+ * gözlemlenebilir kabul edilir.
+ *
+ * Uçucu (volatile) bölgelerle örtüşen erişimler (ör. bellek eşlemeli G/Ç) hiçbir geçişte silinmez,
+ * birleştirilmez veya yeniden kullanılmaz.
+ */
+
+// Uçucu bellek bölgesi: [start, end] (iki uç dahil)
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+} MemoryRegion;
+
+typedef struct {
+    const MemoryRegion *regions;
+    size_t count;
+} VolatileMemory;
+
+// Bir talimatın bellek erişimi (size == 0: bellek erişimi değil)
+typedef struct {
+    uint32_t address;
+    uint8_t size;
+    bool known;       // Adres derleme zamanında biliniyor
+    bool is_volatile; // Uçucu bir bölgeyle örtüşüyor (uçucu bölge varken adresi bilinmeyenler dahil)
+} MemoryAccess;
+
+typedef struct {
+    size_t forwarded_stores; // Depolanan değeri kopyayla alan yüklemeler
+    size_t redundant_loads;  // Aynı kelimeyi daha önce okumuş bir kayıttan alınan yüklemeler
+    size_t dead_stores;      // Okunmadan üzerine yazılan depolamalar
+} MemoryFlowStats;
+
+/**
+ * @brief Her talimatın bellek erişimini (adres, boyut, uçuculuk) belirler.
+ * @param volatile_memory: Uçucu bölgeler (NULL: yok).
+ * @param accesses: En az buffer->count elemanlı çıktı dizisi.
+ */
+void memory_flow_classify(const CodeBuffer *buffer, const VolatileMemory *volatile_memory, MemoryAccess *accesses);
+
+/**
+ * @brief Depo-yükleme iletimi, gereksiz yükleme eleme ve ölü depo eleme uygular.
+ * Yerleşimden ve kayıt atamasından önce (sanal kayıtlarla) çalışır.
+ * @return size_t: Değiştirilen veya silinen talimat sayısı.
+ */
+size_t memory_flow_optimize(CodeBuffer *buffer, const VolatileMemory *volatile_memory, MemoryFlowStats *stats);
+
+/**
+ * @brief Geçişin istatistiklerini yazdırır.
+ */
+void memory_flow_print_stats(const MemoryFlowStats *stats);
+
+#endif // BESSAMBLY_MEMORY_FLOW_H
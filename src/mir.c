@@ -0,0 +1,610 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mir.h"
+#include "cfg.h"   // Temel bloklar ve canlılık kümeleri için
+#include "utils.h" // safe_malloc için
+
+// MIR bloğu 0, programın girişini temsil eden boş bloktur; CFG bloğu k, MIR bloğu k + 1 olur.
+// Böylece ilk etikete geri atlanan programlarda da girişteki değerler bir phi ile birleşir.
+#define MIR_ENTRY_BLOCK 0
+
+// Büyüyebilen blok listesi (baskınlık sınırları ve ağaç çocukları için)
+typedef struct {
+    uint32_t *items;
+    uint32_t count;
+    uint32_t capacity;
+} BlockList;
+
+static void block_list_push(BlockList *list, uint32_t block) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 4;
+        list->items = (uint32_t *)safe_realloc(list->items, list->capacity * sizeof(uint32_t));
+    }
+    list->items[list->count++] = block;
+}
+
+// --- Yapı Yardımcıları ---
+
+static MirValueId new_value(MirFunction *mir, Register origin, MirDefKind kind, uint32_t def) {
+    if (mir->value_count == mir->value_capacity) {
+        mir->value_capacity *= 2;
+        mir->values = (MirValue *)safe_realloc(mir->values, mir->value_capacity * sizeof(MirValue));
+    }
+    mir->values[mir->value_count] = (MirValue){origin, kind, def, MIR_NO_USE, 0};
+    return mir->value_count++;
+}
+
+static void add_use(MirFunction *mir, MirValueId value, uint32_t user, uint32_t slot, bool in_phi) {
+    if (mir->use_count == mir->use_capacity) {
+        mir->use_capacity *= 2;
+        mir->uses = (MirUse *)safe_realloc(mir->uses, mir->use_capacity * sizeof(MirUse));
+    }
+    MirValue *v = &mir->values[value];
+    mir->uses[mir->use_count] = (MirUse){user, slot, in_phi, v->first_use};
+    v->first_use = mir->use_count++;
+    v->use_count++;
+}
+
+static void new_phi(MirFunction *mir, uint32_t block, Register origin) {
+    if (mir->phi_count == mir->phi_capacity) {
+        mir->phi_capacity = mir->phi_capacity ? mir->phi_capacity * 2 : 16;
+        mir->phis = (MirPhi *)safe_realloc(mir->phis, mir->phi_capacity * sizeof(MirPhi));
+    }
+    MirBlock *b = &mir->blocks[block];
+    uint32_t index = mir->phi_count++;
+    MirPhi *phi = &mir->phis[index];
+    phi->block = block;
+    phi->dead = false;
+    phi->args = (MirValueId *)safe_malloc((b->predecessor_count + 1) * sizeof(MirValueId));
+    for (uint32_t p = 0; p < b->predecessor_count; p++) phi->args[p] = MIR_NO_VALUE;
+    phi->def = new_value(mir, origin, MIR_DEF_PHI, index);
+
+    if (b->phi_count == b->phi_capacity) {
+        b->phi_capacity = b->phi_capacity ? b->phi_capacity * 2 : 4;
+        b->phis = (uint32_t *)safe_realloc(b->phis, b->phi_capacity * sizeof(uint32_t));
+    }
+    b->phis[b->phi_count++] = index;
+}
+
+static uint32_t predecessor_index(const MirBlock *block, uint32_t predecessor) {
+    for (uint32_t p = 0; p < block->predecessor_count; p++) {
+        if (block->predecessors[p] == predecessor) return p;
+    }
+    return MIR_NO_BLOCK; // Ulaşılmamalı
+}
+
+/**
+ * @brief Talimatın rs1/rs2 alanından birinin gerçekten okunup okunmadığını kontrol eder.
+ */
+static bool reads_register(const Instruction *inst, Register reg) {
+    Register uses[2];
+    int count = cfg_instruction_uses(inst, uses);
+    for (int u = 0; u < count; u++) {
+        if (uses[u] == reg) return true;
+    }
+    return false;
+}
+
+// --- 1. Bloklar ve Öncüller ---
+
+static void build_blocks(MirFunction *mir, const ControlFlowGraph *cfg, const CodeBuffer *buffer) {
+    mir->block_count = (uint32_t)cfg->block_count + 1;
+    mir->blocks = (MirBlock *)safe_malloc(mir->block_count * sizeof(MirBlock));
+    memset(mir->blocks, 0, mir->block_count * sizeof(MirBlock));
+
+    mir->inst_count = (uint32_t)buffer->count;
+    mir->insts = (MirInst *)safe_malloc((mir->inst_count + 1) * sizeof(MirInst));
+    mir->next_label = SYMBOL_ID_NONE + 1;
+    mir->next_register = cfg->register_count;
+
+    MirBlock *entry = &mir->blocks[MIR_ENTRY_BLOCK];
+    entry->successors[0] = cfg->block_count > 0 ? 1 : MIR_NO_BLOCK;
+    entry->successors[1] = MIR_NO_BLOCK;
+
+    for (size_t k = 0; k < cfg->block_count; k++) {
+        const BasicBlock *source = &cfg->blocks[k];
+        MirBlock *block = &mir->blocks[k + 1];
+        block->first = (uint32_t)source->start;
+        block->end = (uint32_t)source->end;
+        for (int s = 0; s < 2; s++) {
+            block->successors[s] = source->successors[s] == CFG_NO_BLOCK ? MIR_NO_BLOCK : (uint32_t)source->successors[s] + 1;
+        }
+        for (size_t i = source->start; i < source->end; i++) {
+            const Instruction *inst = &buffer->instructions[i];
+            mir->insts[i] = (MirInst){*inst, MIR_NO_VALUE, {MIR_NO_VALUE, MIR_NO_VALUE}, (uint32_t)k + 1, false};
+            if (inst->label >= mir->next_label) mir->next_label = inst->label + 1;
+        }
+    }
+
+    // Öncüller: Dallanmanın hedefi düşme bloğuyla aynıysa kenar bir kez sayılır
+    for (uint32_t b = 0; b < mir->block_count; b++) {
+        MirBlock *block = &mir->blocks[b];
+        for (int s = 0; s < 2; s++) {
+            uint32_t succ = block->successors[s];
+            if (succ == MIR_NO_BLOCK || (s == 1 && succ == block->successors[0])) continue;
+            mir->blocks[succ].predecessor_count++;
+        }
+    }
+    for (uint32_t b = 0; b < mir->block_count; b++) {
+        MirBlock *block = &mir->blocks[b];
+        block->predecessors = (uint32_t *)safe_malloc((block->predecessor_count + 1) * sizeof(uint32_t));
+        block->predecessor_count = 0;
+    }
+    for (uint32_t b = 0; b < mir->block_count; b++) {
+        MirBlock *block = &mir->blocks[b];
+        for (int s = 0; s < 2; s++) {
+            uint32_t succ = block->successors[s];
+            if (succ == MIR_NO_BLOCK || (s == 1 && succ == block->successors[0])) continue;
+            MirBlock *target = &mir->blocks[succ];
+            target->predecessors[target->predecessor_count++] = b;
+        }
+    }
+}
+
+// --- 2. Baskınlık Ağacı (Cooper, Harvey, Kennedy: "A Simple, Fast Dominance Algorithm") ---
+
+/**
+ * @brief Girişten erişilebilen blokları ters sonrası sırada (reverse postorder) döndürür.
+ * @return uint32_t: Erişilebilir blok sayısı.
+ */
+static uint32_t reverse_postorder(MirFunction *mir, uint32_t *order) {
+    uint32_t *stack = (uint32_t *)safe_malloc((mir->block_count + 1) * sizeof(uint32_t));
+    uint8_t *next_successor = (uint8_t *)safe_malloc(mir->block_count + 1);
+    memset(next_successor, 0, mir->block_count + 1);
+
+    uint32_t depth = 0, visited = 0;
+    stack[depth++] = MIR_ENTRY_BLOCK;
+    mir->blocks[MIR_ENTRY_BLOCK].reachable = true;
+    while (depth > 0) {
+        uint32_t b = stack[depth - 1];
+        if (next_successor[b] < 2) {
+            uint32_t succ = mir->blocks[b].successors[next_successor[b]++];
+            if (succ != MIR_NO_BLOCK && !mir->blocks[succ].reachable) {
+                mir->blocks[succ].reachable = true;
+                stack[depth++] = succ;
+            }
+            continue;
+        }
+        order[visited++] = b; // Sonrası sıra
+        depth--;
+    }
+
+    for (uint32_t i = 0; i < visited / 2; i++) {
+        uint32_t t = order[i];
+        order[i] = order[visited - 1 - i];
+        order[visited - 1 - i] = t;
+    }
+    free(next_successor);
+    free(stack);
+    return visited;
+}
+
+static void compute_dominators(MirFunction *mir) {
+    uint32_t *order = (uint32_t *)safe_malloc((mir->block_count + 1) * sizeof(uint32_t));
+    uint32_t *rank = (uint32_t *)safe_malloc((mir->block_count + 1) * sizeof(uint32_t));
+    uint32_t reachable = reverse_postorder(mir, order);
+    for (uint32_t i = 0; i < reachable; i++) rank[order[i]] = i;
+
+    for (uint32_t b = 0; b < mir->block_count; b++) mir->blocks[b].idom = MIR_NO_BLOCK;
+    mir->blocks[MIR_ENTRY_BLOCK].idom = MIR_ENTRY_BLOCK; // Kesişim döngüsünün durması için geçici
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint32_t i = 1; i < reachable; i++) {
+            MirBlock *block = &mir->blocks[order[i]];
+            uint32_t new_idom = MIR_NO_BLOCK;
+            for (uint32_t p = 0; p < block->predecessor_count; p++) {
+                uint32_t pred = block->predecessors[p];
+                if (mir->blocks[pred].idom == MIR_NO_BLOCK) continue; // Henüz işlenmemiş veya erişilemez
+                if (new_idom == MIR_NO_BLOCK) {
+                    new_idom = pred;
+                    continue;
+                }
+                // Ağaçta iki bloğun ortak atası
+                uint32_t a = pred, c = new_idom;
+                while (a != c) {
+                    while (rank[a] > rank[c]) a = mir->blocks[a].idom;
+                    while (rank[c] > rank[a]) c = mir->blocks[c].idom;
+                }
+                new_idom = a;
+            }
+            if (block->idom != new_idom) {
+                block->idom = new_idom;
+                changed = true;
+            }
+        }
+    }
+    mir->blocks[MIR_ENTRY_BLOCK].idom = MIR_NO_BLOCK;
+
+    free(rank);
+    free(order);
+}
+
+// --- 3. Phi Yerleşimi (baskınlık sınırları, budanmış SSA) ---
+
+static void place_phis(MirFunction *mir, const ControlFlowGraph *cfg) {
+    uint32_t block_count = mir->block_count;
+
+    // Baskınlık sınırları: Birleşme bloğunun her öncülünden baskın bloğuna kadar yürünür
+    BlockList *frontier = (BlockList *)safe_malloc(block_count * sizeof(BlockList));
+    memset(frontier, 0, block_count * sizeof(BlockList));
+    for (uint32_t b = 0; b < block_count; b++) {
+        const MirBlock *block = &mir->blocks[b];
+        if (!block->reachable || block->predecessor_count < 2) continue;
+        for (uint32_t p = 0; p < block->predecessor_count; p++) {
+            uint32_t runner = block->predecessors[p];
+            if (!mir->blocks[runner].reachable) continue;
+            while (runner != block->idom) {
+                BlockList *list = &frontier[runner];
+                if (list->count == 0 || list->items[list->count - 1] != b) block_list_push(list, b);
+                runner = mir->blocks[runner].idom;
+            }
+        }
+    }
+
+    // Sanal kayıt başına tanım blokları (CSR düzeninde)
+    uint32_t register_count = cfg->register_count;
+    uint32_t *def_start = (uint32_t *)safe_malloc(((size_t)register_count + 1) * sizeof(uint32_t));
+    memset(def_start, 0, ((size_t)register_count + 1) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < mir->inst_count; i++) {
+        Register def = cfg_instruction_def(&mir->insts[i].inst);
+        if (REGISTER_IS_VIRTUAL(def)) def_start[def + 1]++;
+    }
+    for (uint32_t r = 0; r < register_count; r++) def_start[r + 1] += def_start[r];
+    uint32_t *def_blocks = (uint32_t *)safe_malloc(((size_t)def_start[register_count] + 1) * sizeof(uint32_t));
+    uint32_t *fill = (uint32_t *)safe_malloc(((size_t)register_count + 1) * sizeof(uint32_t));
+    memcpy(fill, def_start, (size_t)register_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < mir->inst_count; i++) {
+        Register def = cfg_instruction_def(&mir->insts[i].inst);
+        if (REGISTER_IS_VIRTUAL(def)) def_blocks[fill[def]++] = mir->insts[i].block;
+    }
+
+    // Her kayıt için yinelenen baskınlık sınırı; phi yalnızca kayıt blok girişinde canlıysa eklenir
+    uint32_t *has_phi = (uint32_t *)safe_malloc(block_count * sizeof(uint32_t));
+    uint32_t *queued = (uint32_t *)safe_malloc(block_count * sizeof(uint32_t));
+    uint32_t *work = (uint32_t *)safe_malloc(((size_t)block_count + def_start[register_count] + 1) * sizeof(uint32_t));
+    memset(has_phi, 0, block_count * sizeof(uint32_t));
+    memset(queued, 0, block_count * sizeof(uint32_t));
+
+    for (uint32_t r = R_VIRTUAL_BASE; r < register_count; r++) {
+        uint32_t marker = r + 1; // 0 "hiç işaretlenmedi" anlamına gelir
+        uint32_t work_count = 0;
+        for (uint32_t d = def_start[r]; d < def_start[r + 1]; d++) {
+            uint32_t b = def_blocks[d];
+            if (queued[b] != marker) {
+                queued[b] = marker;
+                work[work_count++] = b;
+            }
+        }
+        while (work_count > 0) {
+            uint32_t x = work[--work_count];
+            for (uint32_t f = 0; f < frontier[x].count; f++) {
+                uint32_t y = frontier[x].items[f];
+                if (has_phi[y] == marker) continue;
+                if (!cfg_set_contains(cfg, cfg_live_in(cfg, y - 1), (Register)r)) continue; // Budama: girişte ölü
+                new_phi(mir, y, (Register)r);
+                has_phi[y] = marker;
+                if (queued[y] != marker) {
+                    queued[y] = marker;
+                    work[work_count++] = y;
+                }
+            }
+        }
+    }
+
+    free(work);
+    free(queued);
+    free(has_phi);
+    free(fill);
+    free(def_blocks);
+    free(def_start);
+    for (uint32_t b = 0; b < block_count; b++) free(frontier[b].items);
+    free(frontier);
+}
+
+// --- 4. Yeniden Adlandırma (baskınlık ağacında derinlik öncelikli) ---
+
+typedef struct {
+    MirValueId *current;     // Kayıt başına şu anki değer
+    MirValueId *entry;       // Kayıt başına giriş değeri (tembel oluşturulur)
+    Register *saved_register; // Geri alma günlüğü: değiştirilen kayıt ve önceki değeri
+    MirValueId *saved_value;
+    uint32_t saved_count;
+} RenameState;
+
+static MirValueId current_value(MirFunction *mir, RenameState *state, Register reg) {
+    if (state->current[reg] != MIR_NO_VALUE) return state->current[reg];
+    if (state->entry[reg] == MIR_NO_VALUE) state->entry[reg] = new_value(mir, reg, MIR_DEF_ENTRY, 0);
+    return state->entry[reg];
+}
+
+static void push_definition(RenameState *state, Register reg, MirValueId value) {
+    state->saved_register[state->saved_count] = reg;
+    state->saved_value[state->saved_count] = state->current[reg];
+    state->saved_count++;
+    state->current[reg] = value;
+}
+
+static void undo_definitions(RenameState *state, uint32_t mark) {
+    while (state->saved_count > mark) {
+        state->saved_count--;
+        state->current[state->saved_register[state->saved_count]] = state->saved_value[state->saved_count];
+    }
+}
+
+static void rename_block(MirFunction *mir, RenameState *state, uint32_t b) {
+    MirBlock *block = &mir->blocks[b];
+    for (uint32_t p = 0; p < block->phi_count; p++) {
+        const MirPhi *phi = &mir->phis[block->phis[p]];
+        push_definition(state, mir->values[phi->def].origin, phi->def);
+    }
+
+    for (uint32_t i = block->first; i < block->end; i++) {
+        MirInst *mi = &mir->insts[i];
+        Register operands[2] = {mi->inst.rs1, mi->inst.rs2};
+        for (int slot = 0; slot < 2; slot++) {
+            if (!REGISTER_IS_VIRTUAL(operands[slot]) || !reads_register(&mi->inst, operands[slot])) continue;
+            mi->uses[slot] = current_value(mir, state, operands[slot]);
+            add_use(mir, mi->uses[slot], i, (uint32_t)slot, false);
+        }
+        Register def = cfg_instruction_def(&mi->inst);
+        if (REGISTER_IS_VIRTUAL(def)) {
+            mi->def = new_value(mir, def, MIR_DEF_INST, i);
+            push_definition(state, def, mi->def);
+        }
+    }
+
+    // Ardılların phi argümanları: Bu kenardan gelen değer
+    for (int s = 0; s < 2; s++) {
+        uint32_t succ = block->successors[s];
+        if (succ == MIR_NO_BLOCK || (s == 1 && succ == block->successors[0])) continue;
+        MirBlock *target = &mir->blocks[succ];
+        uint32_t index = predecessor_index(target, b);
+        for (uint32_t p = 0; p < target->phi_count; p++) {
+            MirPhi *phi = &mir->phis[target->phis[p]];
+            phi->args[index] = current_value(mir, state, mir->values[phi->def].origin);
+            add_use(mir, phi->args[index], target->phis[p], index, true);
+        }
+    }
+}
+
+static void rename_values(MirFunction *mir) {
+    uint32_t block_count = mir->block_count;
+    uint32_t register_count = mir->next_register;
+
+    // Baskınlık ağacının çocuk listeleri
+    BlockList *children = (BlockList *)safe_malloc(block_count * sizeof(BlockList));
+    memset(children, 0, block_count * sizeof(BlockList));
+    for (uint32_t b = 0; b < block_count; b++) {
+        if (mir->blocks[b].idom != MIR_NO_BLOCK) block_list_push(&children[mir->blocks[b].idom], b);
+    }
+
+    RenameState state;
+    state.current = (MirValueId *)safe_malloc(((size_t)register_count + 1) * sizeof(MirValueId));
+    state.entry = (MirValueId *)safe_malloc(((size_t)register_count + 1) * sizeof(MirValueId));
+    memset(state.current, 0, ((size_t)register_count + 1) * sizeof(MirValueId));
+    memset(state.entry, 0, ((size_t)register_count + 1) * sizeof(MirValueId));
+    size_t log_capacity = (size_t)mir->inst_count + mir->phi_count + 1;
+    state.saved_register = (Register *)safe_malloc(log_capacity * sizeof(Register));
+    state.saved_value = (MirValueId *)safe_malloc(log_capacity * sizeof(MirValueId));
+    state.saved_count = 0;
+
+    // Yinelemeli DFS: Yığın girişi (blok, sıradaki çocuk, geri alma işareti)
+    uint32_t *stack_block = (uint32_t *)safe_malloc((block_count + 1) * sizeof(uint32_t));
+    uint32_t *stack_child = (uint32_t *)safe_malloc((block_count + 1) * sizeof(uint32_t));
+    uint32_t *stack_mark = (uint32_t *)safe_malloc((block_count + 1) * sizeof(uint32_t));
+    uint32_t depth = 0;
+
+    stack_block[0] = MIR_ENTRY_BLOCK;
+    stack_child[0] = 0;
+    stack_mark[0] = 0;
+    depth = 1;
+    rename_block(mir, &state, MIR_ENTRY_BLOCK);
+    while (depth > 0) {
+        uint32_t b = stack_block[depth - 1];
+        if (stack_child[depth - 1] < children[b].count) {
+            uint32_t child = children[b].items[stack_child[depth - 1]++];
+            stack_block[depth] = child;
+            stack_child[depth] = 0;
+            stack_mark[depth] = state.saved_count;
+            depth++;
+            rename_block(mir, &state, child);
+            continue;
+        }
+        undo_definitions(&state, stack_mark[depth - 1]);
+        depth--;
+    }
+
+    // Erişilemeyen bloklar (ör. HALT'tan sonraki yardımcı rutinler) kendi başlarına adlandırılır
+    for (uint32_t b = 0; b < block_count; b++) {
+        if (mir->blocks[b].reachable) continue;
+        rename_block(mir, &state, b);
+        undo_definitions(&state, 0);
+    }
+
+    free(stack_mark);
+    free(stack_child);
+    free(stack_block);
+    free(state.saved_value);
+    free(state.saved_register);
+    free(state.entry);
+    free(state.current);
+    for (uint32_t b = 0; b < block_count; b++) free(children[b].items);
+    free(children);
+}
+
+// --- 5. SSA'dan Çıkış ---
+
+static Register value_register(const MirFunction *mir, MirValueId value, Register fallback) {
+    return value == MIR_NO_VALUE ? fallback : mir->values[value].origin;
+}
+
+/**
+ * @brief b -> succ kenarındaki phi kopyalarını üretir. Kopyalar paralel anlamlıdır: Başka bir
+ * kopyanın hedefi olan kaynaklar, hiçbir kopya yazmadan önce yeni bir geçici sanal kayda alınır.
+ * @return size_t: Üretilen kopya sayısı.
+ */
+static size_t emit_edge_copies(const MirFunction *mir, uint32_t b, uint32_t succ, uint32_t *next_register, CodeBuffer *out) {
+    if (succ == MIR_NO_BLOCK) return 0;
+    const MirBlock *target = &mir->blocks[succ];
+    if (target->phi_count == 0) return 0;
+    uint32_t index = predecessor_index(target, b);
+
+    Register *dst = (Register *)safe_malloc(target->phi_count * sizeof(Register));
+    Register *src = (Register *)safe_malloc(target->phi_count * sizeof(Register));
+    uint32_t count = 0;
+    for (uint32_t p = 0; p < target->phi_count; p++) {
+        const MirPhi *phi = &mir->phis[target->phis[p]];
+        if (phi->dead) continue;
+        dst[count] = mir->values[phi->def].origin;
+        src[count] = value_register(mir, phi->args[index], dst[count]);
+        if (dst[count] != src[count]) count++;
+    }
+
+    size_t emitted = 0;
+    for (uint32_t c = 0; c < count; c++) {
+        for (uint32_t k = 0; k < count; k++) {
+            if (k == c || src[c] != dst[k]) continue;
+            Register temp = (Register)(*next_register)++;
+            code_buffer_append(out, (Instruction){I_ADD, temp, src[c], R_ZERO, 0, SYMBOL_ID_NONE});
+            src[c] = temp;
+            emitted++;
+            break;
+        }
+    }
+    for (uint32_t c = 0; c < count; c++) {
+        code_buffer_append(out, (Instruction){I_ADD, dst[c], src[c], R_ZERO, 0, SYMBOL_ID_NONE});
+        emitted++;
+    }
+
+    free(src);
+    free(dst);
+    return emitted;
+}
+
+static bool edge_needs_copies(const MirFunction *mir, uint32_t b, uint32_t succ) {
+    if (succ == MIR_NO_BLOCK) return false;
+    const MirBlock *target = &mir->blocks[succ];
+    if (target->phi_count == 0) return false;
+    uint32_t index = predecessor_index(target, b);
+    for (uint32_t p = 0; p < target->phi_count; p++) {
+        const MirPhi *phi = &mir->phis[target->phis[p]];
+        if (!phi->dead && value_register(mir, phi->args[index], mir->values[phi->def].origin) != mir->values[phi->def].origin) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void mir_lower(const MirFunction *mir, CodeBuffer *buffer) {
+    CodeBuffer out = {(Instruction *)safe_malloc((mir->inst_count + 16) * sizeof(Instruction)), 0, mir->inst_count + 16,
+                      buffer->spill_base};
+    CodeBuffer tail = {(Instruction *)safe_malloc(16 * sizeof(Instruction)), 0, 16, 0}; // Bölünmüş kenar blokları
+    uint32_t next_register = mir->next_register;
+    SymbolId next_label = mir->next_label;
+    size_t copies = 0;
+
+    for (uint32_t b = 0; b < mir->block_count; b++) {
+        const MirBlock *block = &mir->blocks[b];
+        const MirInst *terminator = NULL;
+        for (uint32_t i = block->first; i < block->end; i++) {
+            const MirInst *mi = &mir->insts[i];
+            if (mi->dead) continue;
+            if (i + 1 == block->end && cfg_is_terminator(mi->inst.type)) {
+                terminator = mi;
+                break;
+            }
+            Instruction inst = mi->inst;
+            inst.rd = value_register(mir, mi->def, inst.rd);
+            inst.rs1 = value_register(mir, mi->uses[0], inst.rs1);
+            inst.rs2 = value_register(mir, mi->uses[1], inst.rs2);
+            code_buffer_append(&out, inst);
+        }
+
+        if (terminator == NULL || terminator->inst.type == I_JAL) {
+            // Tek ardıl (düşme veya koşulsuz atlama): Kopyalar atlamadan önce
+            copies += emit_edge_copies(mir, b, block->successors[0], &next_register, &out);
+        }
+        if (terminator == NULL) continue;
+
+        Instruction inst = terminator->inst;
+        inst.rd = value_register(mir, terminator->def, inst.rd);
+        inst.rs1 = value_register(mir, terminator->uses[0], inst.rs1);
+        inst.rs2 = value_register(mir, terminator->uses[1], inst.rs2);
+
+        if (block->successors[1] != MIR_NO_BLOCK && edge_needs_copies(mir, b, block->successors[1])) {
+            // Alınan dallanma kenarı bölünür: L': kopyalar; JAL x0, hedef
+            code_buffer_append(&tail, (Instruction){I_A_LABEL, R_ZERO, R_ZERO, R_ZERO, 0, next_label});
+            copies += emit_edge_copies(mir, b, block->successors[1], &next_register, &tail);
+            code_buffer_append(&tail, (Instruction){I_JAL, R_ZERO, R_ZERO, R_ZERO, 0, inst.label});
+            inst.label = next_label++;
+        }
+        code_buffer_append(&out, inst);
+
+        if (block->successors[1] != MIR_NO_BLOCK) {
+            // Koşullu dallanmanın düşme kenarı: Kopyalar dallanmadan sonra, sonraki bloğun etiketinden önce
+            copies += emit_edge_copies(mir, b, block->successors[0], &next_register, &out);
+        }
+    }
+
+    for (size_t i = 0; i < tail.count; i++) code_buffer_append(&out, tail.instructions[i]);
+    free(tail.instructions);
+
+    free(buffer->instructions);
+    buffer->instructions = out.instructions;
+    buffer->count = out.count;
+    buffer->capacity = out.capacity;
+
+    if (copies > 0) printf("SSA'dan Çıkış: %zu phi kopyası eklendi.\n", copies);
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+MirFunction *mir_build(const CodeBuffer *buffer) {
+    MirFunction *mir = (MirFunction *)safe_malloc(sizeof(MirFunction));
+    memset(mir, 0, sizeof(MirFunction));
+
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+
+    mir->value_capacity = (uint32_t)buffer->count + 16;
+    mir->values = (MirValue *)safe_malloc(mir->value_capacity * sizeof(MirValue));
+    mir->value_count = 1; // MIR_NO_VALUE
+    mir->use_capacity = 2 * (uint32_t)buffer->count + 16;
+    mir->uses = (MirUse *)safe_malloc(mir->use_capacity * sizeof(MirUse));
+
+    build_blocks(mir, cfg, buffer);
+    compute_dominators(mir);
+    place_phis(mir, cfg);
+    rename_values(mir);
+    cfg_free(cfg);
+
+    printf("SSA: %u blok, %u değer, %u phi düğümü, %u kullanım.\n",
+           mir->block_count - 1, mir->value_count - 1, mir->phi_count, mir->use_count);
+    return mir;
+}
+
+bool mir_dominates(const MirFunction *mir, uint32_t a, uint32_t b) {
+    while (b != MIR_NO_BLOCK) {
+        if (b == a) return true;
+        b = mir->blocks[b].idom;
+    }
+    return false;
+}
+
+void mir_free(MirFunction *mir) {
+    if (mir == NULL) return;
+    for (uint32_t b = 0; b < mir->block_count; b++) {
+        free(mir->blocks[b].predecessors);
+        free(mir->blocks[b].phis);
+    }
+    for (uint32_t p = 0; p < mir->phi_count; p++) free(mir->phis[p].args);
+    free(mir->blocks);
+    free(mir->insts);
+    free(mir->phis);
+    free(mir->values);
+    free(mir->uses);
+    free(mir);
+}
@@ -0,0 +1,133 @@
+#ifndef BESSAMBLY_MIR_H
+#define BESSAMBLY_MIR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+
+/**
+ * @brief Orta Seviye IR (MIR): SSA biçiminde temel bloklar
+ * Komut seçicinin ürettiği talimatlar (sanal kayıtlarla, yerleşimden önce) temel bloklara
+ * ayrılır ve sanal kayıtlar SSA değerlerine yeniden adlandırılır: Her değerin tek bir tanımı
+ * vardır, birden fazla tanımın birleştiği etiketlerde phi düğümleri bulunur (budanmış SSA:
+ * yalnızca bloğun girişinde canlı olan kayıtlar için). Her değer kullanımlarının listesini
+ * (def-use zinciri) tutar; böylece veri akışı geçişleri bir değerin tüm kullanıcılarına
+ * talimat dizisini taramadan ulaşır.
+ *
+ * Fiziksel kayıtlar (T0/T1 ifade geçicileri, gp, ...) SSA'ya çevrilmez; talimatta olduğu gibi kalır.
+ * Geri indirme (mir_lower) her değeri kaynak sanal kaydına geri adlandırır; kaynakları farklı
+ * phi argümanları için öncül kenarlarına kopya eklenir. Bu yüzden geçişler aynı kaynağın iki
+ * sürümünü aynı anda canlı bırakmamalıdır (geleneksel SSA): Bir kullanımı sabitle değiştirmek
+ * veya talimat silmek serbesttir, kopya yayılımı ise kaynağı değiştirmelidir.
+ */
+
+typedef uint32_t MirValueId;
+#define MIR_NO_VALUE 0       // Değer yok (fiziksel kayıt veya kullanılmayan operant)
+#define MIR_NO_USE UINT32_MAX // Kullanım listesi sonu
+#define MIR_NO_BLOCK UINT32_MAX
+
+// Değerin tanım biçimi
+typedef enum {
+    MIR_DEF_ENTRY, // Program girişindeki değer (tanımından önce okunan kayıt)
+    MIR_DEF_INST,  // Bir talimatın sonucu (def: talimat indeksi)
+    MIR_DEF_PHI    // Phi düğümü (def: phi indeksi)
+} MirDefKind;
+
+// SSA değeri
+typedef struct {
+    Register origin;     // Değerin geldiği sanal kayıt (geri indirmede bu isme döner)
+    MirDefKind kind;
+    uint32_t def;        // Tanımlayan talimat veya phi indeksi (MIR_DEF_ENTRY için kullanılmaz)
+    uint32_t first_use;  // Kullanım listesinin başı (MIR_NO_USE: kullanılmıyor)
+    uint32_t use_count;
+} MirValue;
+
+// Bir değerin tek bir kullanımı (def-use zinciri düğümü)
+typedef struct {
+    uint32_t user;  // Kullanan talimat veya phi indeksi
+    uint32_t slot;  // Talimat: 0 = rs1, 1 = rs2; phi: argüman (öncül) sırası
+    bool in_phi;
+    uint32_t next;  // Aynı değerin sıradaki kullanımı
+} MirUse;
+
+// Talimat: Fiziksel operantlar, sabit ve etiket alanları inst içinde kalır
+typedef struct {
+    Instruction inst;
+    MirValueId def;     // rd sanal kayıtsa tanımlanan değer
+    MirValueId uses[2]; // rs1/rs2 sanal kayıtsa okunan değerler
+    uint32_t block;
+    bool dead;          // Silinmiş talimat (geri indirmede atlanır)
+} MirInst;
+
+// Phi düğümü: args[i], bloğun i. öncülünden gelen değerdir
+typedef struct {
+    MirValueId def;
+    uint32_t block;
+    MirValueId *args;
+    bool dead;
+} MirPhi;
+
+typedef struct {
+    uint32_t first, end;      // Talimat aralığı [first, end)
+    uint32_t successors[2];   // MIR_NO_BLOCK: yok (koşullu dallanmada [0] düşme, [1] hedef)
+    uint32_t *predecessors;
+    uint32_t predecessor_count;
+    uint32_t idom;            // Doğrudan baskın blok (giriş ve erişilemeyen bloklar: MIR_NO_BLOCK)
+    uint32_t *phis;           // Bloğun phi düğümleri (indeks)
+    uint32_t phi_count;
+    uint32_t phi_capacity;
+    bool reachable;           // Girişten erişilebilir mi
+} MirBlock;
+
+typedef struct {
+    MirBlock *blocks;
+    uint32_t block_count;
+
+    MirInst *insts;
+    uint32_t inst_count;
+
+    MirPhi *phis;
+    uint32_t phi_count;
+    uint32_t phi_capacity;
+
+    MirValue *values; // values[0] kullanılmaz (MIR_NO_VALUE)
+    uint32_t value_count;
+    uint32_t value_capacity;
+
+    MirUse *uses;
+    uint32_t use_count;
+    uint32_t use_capacity;
+
+    SymbolId next_label;    // Kenar bölme blokları için sıradaki boş etiket kimliği
+    uint32_t next_register; // Paralel kopya geçicileri için sıradaki boş sanal kayıt
+} MirFunction;
+
+/**
+ * @brief Talimat arabelleğinden SSA biçiminde MIR oluşturur (CFG, baskınlık ağacı, phi yerleşimi,
+ * yeniden adlandırma ve def-use zincirleri).
+ */
+MirFunction *mir_build(const CodeBuffer *buffer);
+
+/**
+ * @brief MIR'ı talimat arabelleğine geri indirir (SSA'dan çıkış).
+ * Değerler kaynak kayıtlarına döner, silinmiş talimatlar atlanır ve phi argümanları için
+ * gereken kopyalar öncül kenarlarına (gerekirse kenar bölünerek) eklenir.
+ */
+void mir_lower(const MirFunction *mir, CodeBuffer *buffer);
+
+/**
+ * @brief Değerin kullanımlarını gezmek için: for (uint32_t u = mir_first_use(mir, v); u != MIR_NO_USE; u = mir->uses[u].next)
+ */
+static inline uint32_t mir_first_use(const MirFunction *mir, MirValueId value) {
+    return mir->values[value].first_use;
+}
+
+/**
+ * @brief Blok a'nın b'ye baskın olup olmadığını (a, b'ye giden her yolda bulunur mu) kontrol eder.
+ */
+bool mir_dominates(const MirFunction *mir, uint32_t a, uint32_t b);
+
+void mir_free(MirFunction *mir);
+
+#endif // BESSAMBLY_MIR_H
@@ -3,15 +3,56 @@
 #include <string.h>
 #include "optimizer.h"
 #include "error.h"
+#include "mir.h" // SSA biçimindeki orta seviye IR
+#include "peephole.h"
+#include "sccp.h"
+#include "memory_flow.h"
+#include "cfg.h"   // Dallanma yardımcıları için
+#include "utils.h" // safe_malloc için
 
 // --- Optimizasyon Geçişleri (Temel Örnekler) ---
 
+/**
+ * @brief Talimatın tek etkisinin rd kaydına yazmak olup olmadığını kontrol eder.
+ * Atlamalar, depolamalar ve sanal komutlar (HALT, etiket) rd = x0 olsa bile kaldırılamaz.
+ */
+static bool has_only_register_effect(InstructionType type) {
+    switch (type) {
+        case I_ADDI: case I_SUB: case I_ADD: case I_ANDI: case I_ORI: case I_XORI:
+        case I_SLTI: case I_SLTIU: case I_AND: case I_OR: case I_XOR:
+        case I_SLL: case I_SRL: case I_SRA: case I_SLT: case I_SLTU:
+        case I_SLLI: case I_SRLI: case I_SRAI:
+        case I_MUL: case I_MULH: case I_MULHSU: case I_MULHU:
+        case I_DIV: case I_DIVU: case I_REM: case I_REMU:
+        case I_LW: case I_LH: case I_LHU: case I_LB: case I_LBU:
+        case I_LUI: case I_AUIPC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Uçucu bölgelere erişen talimatları işaretler; uçucu bölge yoksa NULL döndürür.
+ * Uçucu yüklemeler sonucu okunmasa bile (okumanın kendisi bir yan etkidir) silinmez.
+ */
+static bool *find_volatile_accesses(const CodeBuffer *buffer, const VolatileMemory *volatile_memory) {
+    if (volatile_memory == NULL || volatile_memory->count == 0 || buffer->count == 0) return NULL;
+    MemoryAccess *accesses = (MemoryAccess *)safe_malloc(buffer->count * sizeof(MemoryAccess));
+    bool *is_volatile = (bool *)safe_malloc(buffer->count);
+    memory_flow_classify(buffer, volatile_memory, accesses);
+    for (size_t i = 0; i < buffer->count; i++) is_volatile[i] = accesses[i].is_volatile;
+    free(accesses);
+    return is_volatile;
+}
+
 /**
  * @brief Optimizasyon 1: NOP (No Operation) komutlarını kaldırır ve basit ölü kod elemeyi yapar.
  * Bu geçişte, bir kayda atanıp hemen ardından kullanılmayan talimatlar da kaldırılabilir.
  */
-static size_t optimize_pass_cleanup(CodeBuffer *buffer) {
+static size_t optimize_pass_cleanup(CodeBuffer *buffer, const VolatileMemory *volatile_memory) {
     size_t removed_count = 0;
+    bool *is_volatile = find_volatile_accesses(buffer, volatile_memory);
     
     // NOP olarak tanımlanmış bir talimatımız yok, ama bazı talimatlar NOP olarak işlev görebilir.
     // Örnek: ADD x0, x0, x0 -> x0 (zero register) değişmeyeceği için NOP'tur.
@@ -35,7 +76,8 @@ static size_t optimize_pass_cleanup(CodeBuffer *buffer) {
         
         // Kural 2: ADD x0, rs1, rs2 (Zero register'a atama yapılıyorsa, sonucu kullanılmaz)
         // Bessambly için basit Ölü Kod Eleme (Dead Code Elimination)
-        if (current->type != I_SW && current->rd == R_ZERO) {
+        if (has_only_register_effect(current->type) && current->rd == R_ZERO &&
+            (is_volatile == NULL || !is_volatile[read_idx])) {
             is_redundant = true;
         }
 
@@ -51,9 +93,321 @@ static size_t optimize_pass_cleanup(CodeBuffer *buffer) {
     }
     
     buffer->count = write_idx;
+    free(is_volatile);
     return removed_count;
 }
 
+// Atlama zinciri düzleştirme istatistikleri (optimizasyon turları boyunca birikir)
+typedef struct {
+    size_t retargeted; // Zincirin sonuna yeniden yönlendirilen atlamalar
+    size_t removed;    // Hemen sonraki talimata giden atlamalar
+    size_t inverted;   // "if ... goto X; goto Y; X:" -> tek ters dallanma
+} JumpThreadingStats;
+
+#define JUMP_UNRESOLVED 0 // Etiketin son hedefi henüz hesaplanmadı
+#define JUMP_IN_PROGRESS 1
+#define JUMP_RESOLVED 2
+
+/**
+ * @brief Talimatın bir etikete atlayıp atlamadığını kontrol eder (JAL veya koşullu dallanma).
+ */
+static bool is_label_jump(const Instruction *inst) {
+    return (inst->type == I_JAL || cfg_is_branch(inst->type)) && inst->label != SYMBOL_ID_NONE;
+}
+
+/**
+ * @brief Etiketin ardından (araya giren diğer etiketler atlanarak) gelen ilk talimatın dizinini döndürür.
+ */
+static size_t skip_labels(const CodeBuffer *buffer, size_t index) {
+    while (index < buffer->count && buffer->instructions[index].type == I_A_LABEL) index++;
+    return index;
+}
+
+/**
+ * @brief index konumundan başlayan etiket dizisinde label etiketi tanımlanıyor mu?
+ * (Etiketler kod üretmez; böyle bir etikete atlamak bir sonraki talimata geçmektir.)
+ */
+static bool label_follows(const CodeBuffer *buffer, size_t index, SymbolId label) {
+    for (; index < buffer->count && buffer->instructions[index].type == I_A_LABEL; index++) {
+        if (buffer->instructions[index].label == label) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Optimizasyon 2: Atlama Zinciri Düzleştirme (Jump Threading)
+ * Her etiketin son hedefi, etiketin bloğu koşulsuz bir atlamadan (goto) ibaret olduğu sürece
+ * zincir izlenerek bulunur (goto L1; L1: goto L2 -> goto L2). Koşullu ve koşulsuz tüm atlamalar bu
+ * son hedefe yönlendirilir; ardından bir sonraki talimata giden atlamalar silinir ve
+ * "if ... goto X; goto Y; X:" kalıbı tek bir ters dallanmaya (if !... goto Y) çevrilir.
+ * Döngü oluşturan zincirler (L1: goto L2; L2: goto L1) olduğu gibi bırakılır.
+ */
+static size_t optimize_pass_jump_threading(CodeBuffer *buffer, JumpThreadingStats *stats) {
+    Instruction *instructions = buffer->instructions;
+    size_t count = buffer->count;
+
+    SymbolId max_label = SYMBOL_ID_NONE;
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].label > max_label) max_label = instructions[i].label;
+    }
+    if (max_label == SYMBOL_ID_NONE) return 0;
+
+    // Etiket -> tanımlandığı talimat dizini (count: bu arabellekte tanımlı değil)
+    size_t *label_index = (size_t *)safe_malloc(((size_t)max_label + 1) * sizeof(size_t));
+    SymbolId *target = (SymbolId *)safe_malloc(((size_t)max_label + 1) * sizeof(SymbolId));
+    uint8_t *state = (uint8_t *)safe_malloc((size_t)max_label + 1);
+    SymbolId *path = (SymbolId *)safe_malloc(((size_t)max_label + 1) * sizeof(SymbolId));
+    memset(state, JUMP_UNRESOLVED, (size_t)max_label + 1);
+    for (SymbolId id = 0; id <= max_label; id++) label_index[id] = count;
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].type == I_A_LABEL) label_index[instructions[i].label] = i;
+    }
+
+    // 1. Her etiketin son hedefini bul: Zincir izlenir, yol üzerindeki tüm etiketler aynı sonuca bağlanır
+    for (SymbolId id = 1; id <= max_label; id++) {
+        if (state[id] != JUMP_UNRESOLVED) continue;
+        size_t depth = 0;
+        SymbolId current = id, final = id;
+        while (true) {
+            if (state[current] == JUMP_RESOLVED) { final = target[current]; break; }
+            if (state[current] == JUMP_IN_PROGRESS) { final = current; break; } // Döngü
+            state[current] = JUMP_IN_PROGRESS;
+            path[depth++] = current;
+
+            size_t next = label_index[current] < count ? skip_labels(buffer, label_index[current]) : count;
+            const Instruction *inst = next < count ? &instructions[next] : NULL;
+            if (!inst || inst->type != I_JAL || inst->rd != R_ZERO || inst->label == SYMBOL_ID_NONE) {
+                final = current;
+                break;
+            }
+            current = inst->label;
+        }
+        for (size_t p = 0; p < depth; p++) {
+            target[path[p]] = final;
+            state[path[p]] = JUMP_RESOLVED;
+        }
+    }
+
+    // 2. Atlamaları zincirin sonuna yönlendir
+    size_t changes = 0;
+    for (size_t i = 0; i < count; i++) {
+        Instruction *inst = &instructions[i];
+        if (!is_label_jump(inst) || target[inst->label] == inst->label) continue;
+        inst->label = target[inst->label];
+        stats->retargeted++;
+        changes++;
+    }
+
+    // 3. Sonraki talimata giden atlamaları sil, dallanma-atlama kalıbını ters çevir
+    size_t write_idx = 0;
+    for (size_t i = 0; i < count; i++) {
+        Instruction inst = instructions[i];
+        bool is_jump = (inst.type == I_JAL && inst.rd == R_ZERO) || cfg_is_branch(inst.type);
+        if (is_jump && inst.label != SYMBOL_ID_NONE) {
+            if (label_follows(buffer, i + 1, inst.label)) {
+                stats->removed++;
+                changes++;
+                continue;
+            }
+            const Instruction *next = i + 1 < count ? &instructions[i + 1] : NULL;
+            if (cfg_is_branch(inst.type) && next && next->type == I_JAL && next->rd == R_ZERO &&
+                next->label != SYMBOL_ID_NONE && label_follows(buffer, i + 2, inst.label)) {
+                inst.type = cfg_invert_branch(inst.type);
+                inst.label = next->label;
+                i++; // Koşulsuz atlama ters dallanmaya katıldı
+                stats->inverted++;
+                changes++;
+            }
+        }
+        instructions[write_idx++] = inst;
+    }
+    buffer->count = write_idx;
+
+    free(label_index);
+    free(target);
+    free(state);
+    free(path);
+    return changes;
+}
+
+// Ölü kod eleme istatistikleri (optimizasyon turları boyunca birikir)
+typedef struct {
+    size_t unreachable; // Erişilemeyen bloklardaki talimatlar (etiketler hariç)
+    size_t dead;        // Sonucu hiç okunmayan talimatlar
+    size_t labels;      // Erişilemeyen veya artık hiçbir atlamanın hedeflemediği etiketler
+} DeadCodeStats;
+
+/**
+ * @brief Girişten (blok 0) kenarlar boyunca erişilebilen blokları işaretler.
+ * @param call_targets: NULL değilse bu etiketleri tanımlayan bloklar (I_A_CALL ile çağrılan
+ * yardımcı rutinler) de kök sayılır.
+ * @return bool*: Blok başına erişilebilirlik (çağıran serbest bırakır).
+ */
+static bool *compute_reachable_blocks(const ControlFlowGraph *cfg, const CodeBuffer *buffer, const bool *call_targets) {
+    bool *reachable = (bool *)safe_malloc(cfg->block_count + 1);
+    size_t *stack = (size_t *)safe_malloc((cfg->block_count + 1) * sizeof(size_t));
+    size_t depth = 0;
+    memset(reachable, 0, cfg->block_count + 1);
+
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        bool root = b == 0;
+        for (size_t i = cfg->blocks[b].start; call_targets && !root && i < cfg->blocks[b].end; i++) {
+            const Instruction *inst = &buffer->instructions[i];
+            root = inst->type == I_A_LABEL && call_targets[inst->label];
+        }
+        if (root) {
+            reachable[b] = true;
+            stack[depth++] = b;
+        }
+    }
+    while (depth > 0) {
+        const BasicBlock *block = &cfg->blocks[stack[--depth]];
+        for (int s = 0; s < 2; s++) {
+            int succ = block->successors[s];
+            if (succ == CFG_NO_BLOCK || reachable[succ]) continue;
+            reachable[succ] = true;
+            stack[depth++] = (size_t)succ;
+        }
+    }
+
+    free(stack);
+    return reachable;
+}
+
+/**
+ * @brief Optimizasyon 3: Erişilemeyen Bloklar ve Yetim Etiketler
+ * Girişten veya bir yardımcı rutin çağrısından (I_A_CALL) erişilemeyen bloklar (ör. koşulsuz
+ * bir atlamadan sonraki etiketsiz kod) silinir; ardından hiçbir atlamanın hedeflemediği etiketler kaldırılır.
+ */
+static size_t optimize_pass_unreachable(CodeBuffer *buffer, DeadCodeStats *stats) {
+    Instruction *instructions = buffer->instructions;
+    size_t count = buffer->count;
+    if (count == 0) return 0;
+
+    SymbolId max_label = SYMBOL_ID_NONE;
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].label > max_label) max_label = instructions[i].label;
+    }
+    bool *call_targets = (bool *)safe_malloc((size_t)max_label + 1);
+    bool *referenced = (bool *)safe_malloc((size_t)max_label + 1);
+    memset(call_targets, 0, (size_t)max_label + 1);
+    memset(referenced, 0, (size_t)max_label + 1);
+    for (size_t i = 0; i < count; i++) {
+        if (instructions[i].type == I_A_CALL) call_targets[instructions[i].label] = true;
+    }
+
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    bool *reachable = compute_reachable_blocks(cfg, buffer, call_targets);
+    bool *keep = (bool *)safe_malloc(count);
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        for (size_t i = cfg->blocks[b].start; i < cfg->blocks[b].end; i++) keep[i] = reachable[b];
+    }
+
+    // Kalan atlama ve çağrıların hedefledikleri etiketler
+    for (size_t i = 0; i < count; i++) {
+        if (keep[i] && instructions[i].type != I_A_LABEL && instructions[i].label != SYMBOL_ID_NONE) {
+            referenced[instructions[i].label] = true;
+        }
+    }
+
+    size_t write_idx = 0, removed = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool is_label = instructions[i].type == I_A_LABEL;
+        if (!keep[i] || (is_label && !referenced[instructions[i].label])) {
+            if (is_label) stats->labels++;
+            else stats->unreachable++;
+            removed++;
+            continue;
+        }
+        instructions[write_idx++] = instructions[i];
+    }
+    buffer->count = write_idx;
+
+    free(keep);
+    free(reachable);
+    cfg_free(cfg);
+    free(referenced);
+    free(call_targets);
+    return removed;
+}
+
+/**
+ * @brief Optimizasyon 4: Canlılık Tabanlı Ölü Kod Eleme
+ * Bloklar canlı çıkış kümelerinden geriye doğru yürünür; tek etkisi bir kayda yazmak olan ve
+ * yazdığı kayıt o noktada canlı olmayan talimat silinir (silinen talimatın okudukları canlı
+ * sayılmaz, böylece blok içindeki ölü zincirler tek geçişte kalkar).
+ * Fiziksel kayıt yazan talimatlar yalnızca girişten erişilen ve bir JALR dönüşüne ulaşmayan
+ * kodda silinir: Yardımcı rutinlerin sonucu (T0) JALR'den sonra canlıdır ama CFG bunu görmez.
+ */
+static size_t optimize_pass_dead_code(CodeBuffer *buffer, const VolatileMemory *volatile_memory, DeadCodeStats *stats) {
+    if (buffer->count == 0) return 0;
+    bool *is_volatile = find_volatile_accesses(buffer, volatile_memory);
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+
+    bool *from_entry = compute_reachable_blocks(cfg, buffer, NULL);
+    bool physical_allowed = true;
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        const BasicBlock *block = &cfg->blocks[b];
+        if (from_entry[b] && block->end > block->start && buffer->instructions[block->end - 1].type == I_JALR) {
+            physical_allowed = false;
+        }
+    }
+
+    bool *remove = (bool *)safe_malloc(buffer->count);
+    memset(remove, 0, buffer->count);
+
+    // seen[r] == blok + 1: r bu blokta taranan kısımda görüldü, live[r] o noktadaki durumu;
+    // görülmeyen kayıt için blok sonu canlılığına bakılır
+    uint32_t *seen = (uint32_t *)safe_malloc(cfg->register_count * sizeof(uint32_t));
+    bool *live = (bool *)safe_malloc(cfg->register_count);
+    memset(seen, 0, cfg->register_count * sizeof(uint32_t));
+
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        uint32_t stamp = (uint32_t)b + 1;
+        for (size_t i = cfg->blocks[b].end; i-- > cfg->blocks[b].start;) {
+            const Instruction *inst = &buffer->instructions[i];
+            Register def = cfg_instruction_def(inst);
+            if (def != R_ZERO && has_only_register_effect(inst->type) &&
+                !(seen[def] == stamp ? live[def] : cfg_set_contains(cfg, cfg_live_out(cfg, b), def)) &&
+                (REGISTER_IS_VIRTUAL(def) || (physical_allowed && from_entry[b])) &&
+                (is_volatile == NULL || !is_volatile[i])) {
+                remove[i] = true;
+                continue;
+            }
+            if (def != R_ZERO) {
+                seen[def] = stamp;
+                live[def] = false;
+            }
+            Register uses[2];
+            int use_count = cfg_instruction_uses(inst, uses);
+            for (int u = 0; u < use_count; u++) {
+                seen[uses[u]] = stamp;
+                live[uses[u]] = true;
+            }
+        }
+    }
+
+    size_t write_idx = 0, removed = 0;
+    for (size_t i = 0; i < buffer->count; i++) {
+        if (remove[i]) {
+            removed++;
+            continue;
+        }
+        buffer->instructions[write_idx++] = buffer->instructions[i];
+    }
+    buffer->count = write_idx;
+    stats->dead += removed;
+
+    free(live);
+    free(seen);
+    free(remove);
+    free(from_entry);
+    free(is_volatile);
+    cfg_free(cfg);
+    return removed;
+}
+
 
 // --- Optimizasyon Bayrakları Yönetimi ---
 
@@ -75,6 +429,7 @@ OptimizationFlags get_optimization_flags(OptimizationLevel level) {
             flags.peephole = true;
             flags.dead_code_elim = true;
             flags.aggressive_jump = true;
+            flags.memory_flow = true;
             break;
             
         case O_LEVEL_O3:
@@ -84,13 +439,17 @@ OptimizationFlags get_optimization_flags(OptimizationLevel level) {
             flags.dead_code_elim = true;
             flags.aggressive_jump = true;
             flags.constant_folding = true;
+            flags.memory_flow = true;
             flags.register_alloc = true; 
+            // -Ofast derleme süresi için hızlı doğrusal taramada kalır
+            flags.graph_coloring = (level == O_LEVEL_O3);
             break;
             
         case O_LEVEL_OSIZE: // Boyut odaklı, performanstan çok küçültme
             flags.remove_nop = true;
             flags.peephole = true;
             flags.aggressive_jump = true;
+            flags.memory_flow = true; // Silinen depolamalar ve yüklemeler kodu da küçültür
             break;
             
         case O_LEVEL_OZ: // Maksimum boyut
@@ -99,6 +458,7 @@ OptimizationFlags get_optimization_flags(OptimizationLevel level) {
             flags.peephole = true;
             flags.aggressive_jump = true;
             flags.dead_code_elim = true;
+            flags.memory_flow = true;
             break;
             
         case O_LEVEL_FLASH: // Teorik maksimum performans
@@ -108,7 +468,9 @@ OptimizationFlags get_optimization_flags(OptimizationLevel level) {
             flags.dead_code_elim = true;
             flags.aggressive_jump = true;
             flags.constant_folding = true;
+            flags.memory_flow = true;
             flags.register_alloc = true; 
+            flags.graph_coloring = true;
             break;
     }
     return flags;
@@ -116,7 +478,7 @@ OptimizationFlags get_optimization_flags(OptimizationLevel level) {
 
 // --- Ana Optimizasyon İşlevi ---
 
-bool optimize_code(CodeBuffer *buffer, OptimizationLevel level) {
+bool optimize_code(CodeBuffer *buffer, OptimizationLevel level, const VolatileMemory *volatile_memory) {
     if (level == O_LEVEL_O0) {
         printf("Optimizasyon Seviyesi -O0: Optimizasyon atlandı.\n");
         return true;
@@ -125,6 +487,20 @@ bool optimize_code(CodeBuffer *buffer, OptimizationLevel level) {
     printf("Optimizasyon Başladı (Seviye: %d)...\n", level);
     OptimizationFlags flags = get_optimization_flags(level);
     size_t total_removed = 0;
+    PeepholeStats peephole_stats = {0};
+    JumpThreadingStats jump_stats = {0};
+    DeadCodeStats dead_stats = {0};
+    MemoryFlowStats memory_stats = {0};
+
+    // 0. Orta Seviye IR: Talimatlar SSA biçimine (bloklar, phi düğümleri, def-use zincirleri)
+    // çevrilir, veri akışı geçişleri bu biçimde çalışır ve sonuç talimat arabelleğine geri indirilir.
+    // Yalnızca MIR üzerinde çalışan bir geçiş (şimdilik SCCP) açıksa kurulur.
+    if (flags.constant_folding) {
+        MirFunction *mir = mir_build(buffer);
+        sccp_optimize(mir);
+        mir_lower(mir, buffer);
+        mir_free(mir);
+    }
     
     // Optimizasyon döngüsü: Optimizasyonlar sürekli olarak kodu değiştirebildiği için
     // genellikle hiçbir şeyin değişmediği bir geçiş olana kadar çalıştırılır.
@@ -136,24 +512,54 @@ bool optimize_code(CodeBuffer *buffer, OptimizationLevel level) {
         
         // 1. Geçiş: Temizlik ve Basit Ölü Kod Eleme
         if (flags.remove_nop || flags.dead_code_elim) {
-            size_t removed = optimize_pass_cleanup(buffer);
+            size_t removed = optimize_pass_cleanup(buffer, volatile_memory);
             changes_made += removed;
             total_removed += removed;
         }
+
+        // 1.1 Geçiş: Erişilemeyen Bloklar ve Canlılık Tabanlı Ölü Kod Eleme
+        if (flags.dead_code_elim) {
+            size_t removed = optimize_pass_unreachable(buffer, &dead_stats);
+            removed += optimize_pass_dead_code(buffer, volatile_memory, &dead_stats);
+            changes_made += removed;
+            total_removed += removed;
+        }
+        
+        // 1.2 Geçiş: MEM[] Veri Akışı (Depo-Yükleme İletimi ve Ölü Depo Eleme)
+        if (flags.memory_flow) {
+            size_t before = buffer->count;
+            changes_made += memory_flow_optimize(buffer, volatile_memory, &memory_stats);
+            total_removed += before - buffer->count;
+        }
         
         // 2. Geçiş: Peephole Optimizasyonları (Basit komut çiftlerini iyileştirme)
         if (flags.peephole) {
-            // ILERI: Gerçek peephole mantığı buraya eklenecektir.
+            size_t before = buffer->count;
+            changes_made += peephole_optimize(buffer, volatile_memory, &peephole_stats);
+            total_removed += before - buffer->count;
         }
 
         // 3. Geçiş: Atlama Zinciri Düzleştirme
         if (flags.aggressive_jump) {
-            // ILERI: goto L1; L1: goto L2 -> goto L2 yapısı buraya eklenecektir.
+            size_t before = buffer->count;
+            changes_made += optimize_pass_jump_threading(buffer, &jump_stats);
+            total_removed += before - buffer->count;
         }
         
         iteration++;
     }
     
+    if (flags.memory_flow) memory_flow_print_stats(&memory_stats);
+    if (flags.peephole) peephole_print_stats(&peephole_stats);
+    if (flags.dead_code_elim) {
+        size_t instructions = dead_stats.unreachable + dead_stats.dead;
+        printf("Ölü Kod Eleme: %zu talimat (%zu bayt) kaldırıldı (%zu erişilemez, %zu sonucu okunmayan), %zu yetim etiket silindi.\n",
+               instructions, instructions * 4, dead_stats.unreachable, dead_stats.dead, dead_stats.labels);
+    }
+    if (flags.aggressive_jump) {
+        printf("Atlama Zinciri: %zu atlama yeniden yönlendirildi, %zu atlama kaldırıldı, %zu dallanma ters çevrildi.\n",
+               jump_stats.retargeted, jump_stats.removed, jump_stats.inverted);
+    }
     printf("Optimizasyon Başarılı. Toplam %zu gereksiz talimat kaldırıldı. Iterasyon: %d\n", total_removed, iteration);
     return true;
 }
\ No newline at end of file
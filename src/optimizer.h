@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+#include "memory_flow.h"  // VolatileMemory için
 
 // Bessambly Derleyicisi Optimizasyon Seviyeleri
 typedef enum {
@@ -19,12 +20,14 @@ typedef enum {
 
 // Optimizasyon Geçişleri İçin Bayraklar
 typedef struct {
-    bool constant_folding;  // Sabit Katlama (A = 5 + 3 -> A = 8)
+    bool constant_folding;  // Seyrek Koşullu Sabit Yayılımı (A = 5; B = A + 3 -> B = 8, bkz. sccp.h)
     bool dead_code_elim;    // Ölü Kod Eleme
     bool peephole;          // Küçük Kod Bloklarının İyileştirilmesi
-    bool register_alloc;    // Kayıt Ataması İyileştirmesi (Şimdilik Basit)
+    bool register_alloc;    // Doğrusal Tarama Kayıt Ataması (kapalıyken sabit atama, bkz. regalloc.h)
+    bool graph_coloring;    // Çizge Boyama Kayıt Ataması ve Kopya Birleştirme (register_alloc yerine)
     bool aggressive_jump;   // Atlama zincirlerini düzleştirme (goto L1; L1: goto L2 -> goto L2)
     bool remove_nop;        // NOP (No Operation) komutlarını kaldırma
+    bool memory_flow;       // MEM[] depo-yükleme iletimi ve ölü depo eleme (bkz. memory_flow.h)
 } OptimizationFlags;
 
 /**
@@ -36,8 +39,9 @@ OptimizationFlags get_optimization_flags(OptimizationLevel level);
  * @brief Kod arabelleğini (RISC-V talimatlarını) belirtilen optimizasyon seviyesine göre optimize eder.
  * @param buffer: Üzerinde çalışılacak CodeBuffer işaretçisi.
  * @param level: Uygulanacak optimizasyon seviyesi.
+ * @param volatile_memory: Erişimleri silinmeyecek/birleştirilmeyecek uçucu bellek bölgeleri (NULL: yok).
  * @return true: Optimizasyon başarılıysa.
  */
-bool optimize_code(CodeBuffer *buffer, OptimizationLevel level);
+bool optimize_code(CodeBuffer *buffer, OptimizationLevel level, const VolatileMemory *volatile_memory);
 
 #endif // BESSAMBLY_OPTIMIZER_H
\ No newline at end of file
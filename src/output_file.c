@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>     // write, close, unlink
+#include <fcntl.h>      // open, O_WRONLY
+#include <sys/stat.h>   // lstat, fchmod, umask, S_ISREG
+
+#include "output_file.h"
+#include "utils.h" // safe_malloc için
+
+// --- Yardımcı İşlevler ---
+
+/**
+ * @brief Tamponun tamamını yazar. write normal dosyalarda tek çağrıda biter; kesilen (EINTR)
+ * veya kısmi yazmalar kalan baytlarla sürdürülür.
+ * @return true eğer tüm baytlar yazıldıysa.
+ */
+static bool write_all(int fd, const char *data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return true;
+}
+
+/**
+ * @brief Hedef normal bir dosya olamadığında (aygıt, boru) veya geçici dosya oluşturulamadığında
+ * dosyayı yerinde yazar.
+ */
+static bool output_file_write_direct(const char *filename, const void *data, size_t length, mode_t mode) {
+    int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    if (fd < 0) {
+        perror("Dosya açma hatası");
+        return false;
+    }
+    bool success = write_all(fd, (const char *)data, length);
+    if (!success) perror("Dosyaya yazma hatası");
+    if (close(fd) < 0 && success) {
+        perror("Dosya kapatma hatası");
+        success = false;
+    }
+    return success;
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+bool output_file_write(const char *filename, const void *data, size_t length, mode_t mode) {
+    // Var olan hedef normal dosya değilse (ör. /dev/stdout) rename onu silip yerine dosya koyardı
+    struct stat st;
+    if (lstat(filename, &st) == 0 && !S_ISREG(st.st_mode)) {
+        return output_file_write_direct(filename, data, length, mode);
+    }
+
+    // Geçici dosya hedefle aynı dizinde olmalıdır; rename yalnızca aynı dosya sisteminde atomiktir
+    size_t name_length = strlen(filename);
+    char *temp_name = (char *)safe_malloc(name_length + sizeof(".XXXXXX"));
+    memcpy(temp_name, filename, name_length);
+    memcpy(temp_name + name_length, ".XXXXXX", sizeof(".XXXXXX"));
+
+    int fd = mkstemp(temp_name);
+    if (fd < 0) {
+        free(temp_name);
+        return output_file_write_direct(filename, data, length, mode);
+    }
+
+    // mkstemp dosyayı 0600 ile oluşturur; open'ın yapacağı gibi istenen izinlere umask uygulanır
+    mode_t mask = umask(0);
+    umask(mask);
+    bool success = fchmod(fd, mode & ~mask) == 0;
+    if (!success) perror("Dosya izinleri ayarlanamadı");
+
+    if (success && !write_all(fd, (const char *)data, length)) {
+        perror("Dosyaya yazma hatası");
+        success = false;
+    }
+    if (close(fd) < 0 && success) {
+        perror("Dosya kapatma hatası");
+        success = false;
+    }
+    if (success && rename(temp_name, filename) < 0) {
+        perror("Çıktı dosyası yerine konamadı");
+        success = false;
+    }
+
+    if (!success) unlink(temp_name);
+    free(temp_name);
+    return success;
+}
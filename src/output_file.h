@@ -0,0 +1,25 @@
+#ifndef BESSAMBLY_OUTPUT_FILE_H
+#define BESSAMBLY_OUTPUT_FILE_H
+
+#include <stddef.h>    // size_t için
+#include <stdbool.h>   // bool için
+#include <sys/types.h> // mode_t için
+
+// Çıktı Dosyası Yazıcı
+// Çıktının tamamı bellekte tek bir bitişik arabellekte hazırlanır ve tek bir write çağrısıyla
+// (kısmi yazmalar tamamlanarak) hedef dizindeki geçici bir dosyaya yazılır. Geçici dosya
+// ardından rename ile hedefin yerine konur: Aynı çıktıyı okuyan paralel bir derleme ya eski
+// dosyayı ya da yeni dosyanın tamamını görür, hiçbir zaman yarım yazılmış bir dosya görmez.
+// Hedef normal bir dosya değilse (ör. /dev/stdout) veya dizine yazılamıyorsa doğrudan yazılır.
+
+/**
+ * @brief Veriyi çıktı dosyasına atomik olarak yazar.
+ * @param filename: Hedef dosya yolu.
+ * @param data: Yazılacak baytlar.
+ * @param length: Bayt sayısı.
+ * @param mode: Yeni dosyanın izinleri (umask uygulanır).
+ * @return true eğer dosya eksiksiz yazılıp yerine konduysa.
+ */
+bool output_file_write(const char *filename, const void *data, size_t length, mode_t mode);
+
+#endif // BESSAMBLY_OUTPUT_FILE_H
@@ -4,6 +4,7 @@
 #include "parser.h"
 #include "error.h" // Hata raporlama için
 #include "utils.h" // Yardımcı fonksiyonlar için
+#include "lexer_scan.h" // Satır sayımı (komut tablosu ön tahsisi) için
 
 // --- Yardımcı Fonksiyonlar ---
 
@@ -76,7 +77,6 @@ static ConditionOperatorType token_to_cond_op(TokenType type) {
  */
 static AST_Operand parse_operand(Parser *parser, bool is_dest) {
     AST_Operand operand = {0};
-    operand.mem_type = MEM_ACCESS_NONE;
 
     if (parser->current_token.type == TOKEN_INTEGER) {
         // Doğrudan sayı sabiti (örn: 10)
@@ -90,7 +90,7 @@ static AST_Operand parse_operand(Parser *parser, bool is_dest) {
     } else if (parser->current_token.type == TOKEN_IDENTIFIER) {
         // Kayıt (örn: A, SUM)
         operand.type = OPR_TYPE_REGISTER;
-        strncpy(operand.name, parser->current_token.lexeme, MAX_LABEL_LENGTH);
+        operand.name = parser->current_token.symbol_id;
         advance_token(parser);
         
     } else if (parser->current_token.type == TOKEN_KEYWORD_MEM) {
@@ -104,7 +104,6 @@ static AST_Operand parse_operand(Parser *parser, bool is_dest) {
         }
         
         operand.type = OPR_TYPE_MEMORY_ADDR;
-        operand.mem_type = MEM_ACCESS_FIXED;
         operand.mem_address = parser->current_token.value;
         advance_token(parser); // Adres tüketildi
         
@@ -157,110 +156,111 @@ static AST_Expr parse_expression(Parser *parser) {
 /**
  * @brief Atama komutunu (dest = expr) ayrıştırır.
  */
-static AST_Node *parse_assignment(Parser *parser, int line_num) {
-    AST_Node *node = ast_node_create(STMT_TYPE_ASSIGNMENT, line_num);
-    
+static void parse_assignment(Parser *parser, int line_num) {
     // 1. Hedef Operant (Sol Taraf)
-    node->data.assignment.destination = parse_operand(parser, true);
+    AST_Operand destination = parse_operand(parser, true);
     
     // 2. Atama Operatörü
     expect_token(parser, TOKEN_OP_EQ, "'=' atama operatörü bekleniyor.");
     
     // 3. İfade (Sağ Taraf)
-    node->data.assignment.expression = parse_expression(parser);
+    AST_Expr expression = parse_expression(parser);
     
-    return node;
+    ast_add_assignment(parser->program, line_num, &destination, &expression);
 }
 
 /**
  * @brief Koşulsuz Atlama (goto TARGET) komutunu ayrıştırır.
  */
-static AST_Node *parse_goto(Parser *parser, int line_num) {
+static void parse_goto(Parser *parser, int line_num) {
     // 'goto' anahtar kelimesi zaten tüketilmiş varsayılıyor.
     
     // 1. Etiket İsmi (IDENTIFIER)
-    expect_token(parser, TOKEN_IDENTIFIER, "'goto' sonrasında hedef etiket ismi bekleniyor.");
+    // Not: expect_token belirteci tükettiği için burada sadece tip kontrolü yapılır.
+    if (parser->current_token.type != TOKEN_IDENTIFIER) {
+        report_error(ERR_SYNTAX_INVALID_TOKEN, parser->current_token.line, "'goto' sonrasında hedef etiket ismi bekleniyor.");
+    }
     
-    AST_Node *node = ast_node_create(STMT_TYPE_GOTO, line_num);
-    strncpy(node->data.goto_stmt.target_label, parser->current_token.lexeme, MAX_LABEL_LENGTH);
+    SymbolId target = parser->current_token.symbol_id;
     advance_token(parser); // Etiket tüketildi
     
-    return node;
+    ast_add_goto(parser->program, line_num, target);
 }
 
 /**
  * @brief Koşullu Atlama (if A > B goto TARGET) komutunu ayrıştırır.
  */
-static AST_Node *parse_if_goto(Parser *parser, int line_num) {
+static void parse_if_goto(Parser *parser, int line_num) {
     // 'if' anahtar kelimesi zaten tüketilmiş varsayılıyor.
     
-    AST_Node *node = ast_node_create(STMT_TYPE_IF_GOTO, line_num);
-    
     // 1. Sol Operant
-    node->data.if_goto_stmt.left = parse_operand(parser, false);
+    AST_Operand left = parse_operand(parser, false);
     
     // 2. Koşul Operatörü
     TokenType op_type = parser->current_token.type;
     if (op_type < TOKEN_OP_LT || op_type > TOKEN_OP_GE) {
          report_error(ERR_SYNTAX_INVALID_TOKEN, parser->current_token.line, "Geçerli bir koşul operatörü bekleniyor (>, <, ==, vb.).");
     }
-    node->data.if_goto_stmt.op = token_to_cond_op(op_type);
+    ConditionOperatorType op = token_to_cond_op(op_type);
     advance_token(parser); // Operatör tüketildi
     
     // 3. Sağ Operant
-    node->data.if_goto_stmt.right = parse_operand(parser, false);
+    AST_Operand right = parse_operand(parser, false);
     
     // 4. 'goto' Anahtar Kelimesi
     expect_token(parser, TOKEN_KEYWORD_GOTO, "Koşuldan sonra 'goto' anahtar kelimesi bekleniyor.");
     
     // 5. Etiket İsmi
-    expect_token(parser, TOKEN_IDENTIFIER, "'goto' sonrasında hedef etiket ismi bekleniyor.");
-    strncpy(node->data.if_goto_stmt.target_label, parser->current_token.lexeme, MAX_LABEL_LENGTH);
+    if (parser->current_token.type != TOKEN_IDENTIFIER) {
+        report_error(ERR_SYNTAX_INVALID_TOKEN, parser->current_token.line, "'goto' sonrasında hedef etiket ismi bekleniyor.");
+    }
+    SymbolId target = parser->current_token.symbol_id;
     advance_token(parser); // Etiket tüketildi
     
-    return node;
+    ast_add_if_goto(parser->program, line_num, &left, op, &right, target);
 }
 
 
 /**
- * @brief Tek bir komutu (statement) ayrıştırır.
+ * @brief Tek bir komutu (statement) ayrıştırır ve komut tablosuna ekler.
  */
-static AST_Node *parse_statement(Parser *parser) {
+static void parse_statement(Parser *parser) {
     Token current = parser->current_token;
     int line_num = current.line;
     
     // 1. Etiket Tanımlama Kontrolü (LABEL:)
     if (current.type == TOKEN_IDENTIFIER && parser->peek_token.type == TOKEN_COLON) {
-        AST_Node *node = ast_node_create(STMT_TYPE_LABEL_DEF, line_num);
-        
         // Etiket adı
-        strncpy(node->data.label_def.label_name, current.lexeme, MAX_LABEL_LENGTH);
+        SymbolId label = current.symbol_id;
         advance_token(parser); // Etiket adı tüketildi
         advance_token(parser); // Kolon (:) tüketildi
         
-        return node;
+        ast_add_label_def(parser->program, line_num, label);
+        return;
     }
     
     // 2. Kontrol Yapıları
     if (current.type == TOKEN_KEYWORD_IF) {
         advance_token(parser); // 'if' tüketildi
-        return parse_if_goto(parser, line_num);
+        parse_if_goto(parser, line_num);
+        return;
     }
     
     if (current.type == TOKEN_KEYWORD_GOTO) {
         advance_token(parser); // 'goto' tüketildi
-        return parse_goto(parser, line_num);
+        parse_goto(parser, line_num);
+        return;
     }
     
     // 3. Atama İşlemi (dest = expr)
     // Atama işlemi bir kayıt (A) veya bir bellek adresi (MEM[..]) ile başlamalıdır.
     if (current.type == TOKEN_IDENTIFIER || current.type == TOKEN_KEYWORD_MEM) {
-        return parse_assignment(parser, line_num);
+        parse_assignment(parser, line_num);
+        return;
     }
     
     // 4. Hata Durumu (Beklenmeyen Komut Başlangıcı)
     report_error(ERR_SYNTAX_INVALID_TOKEN, line_num, "Geçersiz komut başlangıcı (Etiket, Atama, 'if' veya 'goto' bekleniyor).");
-    return NULL;
 }
 
 
@@ -271,6 +271,10 @@ Parser *parser_init(Lexer *lexer) {
     parser->lexer = lexer;
     parser->token_index = 0;
     
+    // Lexer tanımlayıcıları doğrudan programın isim havuzuna ekler
+    parser->program = ast_program_create();
+    lexer->interner = &parser->program->names;
+    
     // Parser'ı başlatmak için ilk iki token'ı oku
     parser->peek_token = lexer_get_next_token(lexer);
     advance_token(parser); 
@@ -279,22 +283,18 @@ Parser *parser_init(Lexer *lexer) {
 }
 
 AST_Program *parser_parse_program(Parser *parser) {
-    AST_Program *program = ast_program_create();
-    AST_Node *current_stmt = NULL;
+    AST_Program *program = parser->program;
+    
+    // Satır sayısı komut tablosu için yalnızca bir başlangıç kapasitesi tahminidir: Tipik programlarda
+    // satır başına bir komut vardır, ancak bir satırda birden fazla komut olabilir ("L: A = 1" etiket
+    // ve atama olarak iki komuttur). Tahmin aşılırsa ast_program_push tabloyu iki katına büyütür.
+    Lexer *lexer = parser->lexer;
+    size_t line_count = lexer_scan_count_newlines(lexer->source_code, lexer->source_length) + 1;
+    ast_program_reserve(program, (AST_StmtIndex)line_count);
     
     // Dosya sonuna kadar komutları ayrıştır
     while (parser->current_token.type != TOKEN_EOF) {
-        AST_Node *new_stmt = parse_statement(parser);
-        
-        if (new_stmt != NULL) {
-            // AST düğümünü bağlı listeye ekle
-            if (program->first_statement == NULL) {
-                program->first_statement = new_stmt;
-            } else {
-                current_stmt->next = new_stmt;
-            }
-            current_stmt = new_stmt;
-        }
+        parse_statement(parser);
         
         // Atamalar ve kontrol komutlarından sonra NEWLINE beklenir (Lexer'da yoksayılıyor) 
         // Ancak burada bir sonraki komutun başında olası fazlalık tokenları kontrol etmeye devam et
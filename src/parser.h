@@ -8,6 +8,7 @@
 // Parser Durum Yapısı
 typedef struct {
     Lexer *lexer;   // İlişkili Lexer (Token kaynağı)
+    AST_Program *program; // Komutların eklendiği program (parser_init tarafından oluşturulur)
     Token current_token; // Şu anda işlenmekte olan belirteç
     Token peek_token;    // Bir sonraki belirteç (göz ucuyla bakmak için)
     int token_index;     // Debug amaçlı token sayacı
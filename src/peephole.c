@@ -0,0 +1,343 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "peephole.h"
+#include "cfg.h"   // Canlılık ve dallanma yardımcıları için
+#include "memory_flow.h" // Uçucu bellek erişimleri için
+#include "utils.h" // safe_malloc için
+
+#define PEEPHOLE_MAX_WINDOW 4
+#define PEEPHOLE_MAX_RETRIES 4 // Bir talimat eklendikten sonra art arda denenen en fazla yeniden yazma
+
+// Kalıp elemanları: Talimat tipi (InstructionType) veya aşağıdaki talimat sınıflarından biri
+enum {
+    PEEP_ANY = I_A_LABEL + 1, // Etiket dışında herhangi bir talimat
+    PEEP_BRANCH,              // Koşullu dallanma (BEQ ... BGEU)
+    PEEP_COPY                 // Kayıt kopyası: ADD rd, rs, x0 / ADDI rd, rs, 0
+};
+
+// Kaynak kaydın bu talimattan sonra canlı olmadığını belirten bayraklar (yalnızca sanal kayıtlar)
+#define DEAD_RS1 0x1
+#define DEAD_RS2 0x2
+
+typedef struct {
+    Instruction inst;
+    uint8_t dead;     // DEAD_RS1 / DEAD_RS2
+    bool is_volatile; // Uçucu bir bellek bölgesine erişim (silinemez, birleştirilemez)
+} PeepInst;
+
+typedef struct {
+    PeepholeRuleId id;
+    const char *name;
+    uint8_t length;
+    uint16_t pattern[PEEPHOLE_MAX_WINDOW];
+    bool (*guard)(const PeepInst *w);
+    uint8_t (*rewrite)(PeepInst *w); // Pencereyi yerinde yeniden yazar, yeni uzunluğu döndürür
+} PeepholeRule;
+
+// --- Yardımcı İşlevler ---
+
+static bool is_copy(const Instruction *inst) {
+    return (inst->type == I_ADD && inst->rs2 == R_ZERO) ||
+           (inst->type == I_ADDI && inst->immediate == 0);
+}
+
+static bool fits_imm12(int64_t value) {
+    return value >= -2048 && value <= 2047;
+}
+
+/**
+ * @brief Talimatın rs1 (slot 0) veya rs2 (slot 1) alanını gerçekten okuyup okumadığını kontrol eder.
+ */
+static bool reads_slot(const Instruction *inst, int slot) {
+    Register reg = slot == 0 ? inst->rs1 : inst->rs2;
+    Register uses[2];
+    int count = cfg_instruction_uses(inst, uses);
+    for (int u = 0; u < count; u++) {
+        if (uses[u] == reg) return true;
+    }
+    return false;
+}
+
+static bool reads_register(const Instruction *inst, Register reg) {
+    return reg != R_ZERO && ((inst->rs1 == reg && reads_slot(inst, 0)) || (inst->rs2 == reg && reads_slot(inst, 1)));
+}
+
+/**
+ * @brief Talimatın okuduğu reg kaydının talimattan sonra ölü olduğu biliniyor mu?
+ */
+static bool dead_after(const PeepInst *p, Register reg) {
+    return (p->inst.rs1 == reg && (p->dead & DEAD_RS1)) || (p->inst.rs2 == reg && (p->dead & DEAD_RS2));
+}
+
+/**
+ * @brief Yeni bir okuma eklenen kaydın önceki talimatlardaki "ölü" bayraklarını temizler.
+ */
+static void clear_dead(PeepInst *p, Register reg) {
+    if (p->inst.rs1 == reg) p->dead &= (uint8_t)~DEAD_RS1;
+    if (p->inst.rs2 == reg) p->dead &= (uint8_t)~DEAD_RS2;
+}
+
+// --- Kurallar ---
+
+// t = s; X(t) -> X(s): X, t'yi okur ve t X'ten sonra ölüdür (veya X t'yi yeniden tanımlar)
+static bool guard_copy_fold(const PeepInst *w) {
+    Register t = w[0].inst.rd, s = w[0].inst.rs1;
+    const Instruction *x = &w[1].inst;
+    if (t == R_ZERO || x->type == I_A_CALL || !reads_register(x, t)) return false;
+    return t == s || cfg_instruction_def(x) == t || dead_after(&w[1], t);
+}
+
+static uint8_t rewrite_copy_fold(PeepInst *w) {
+    Register t = w[0].inst.rd, s = w[0].inst.rs1;
+    bool source_dies = (w[0].dead & DEAD_RS1) != 0;
+    PeepInst x = w[1];
+    for (int slot = 0; slot < 2; slot++) {
+        Register *field = slot == 0 ? &x.inst.rs1 : &x.inst.rs2;
+        if (*field != t || !reads_slot(&w[1].inst, slot)) continue;
+        *field = s;
+        uint8_t bit = slot == 0 ? DEAD_RS1 : DEAD_RS2;
+        x.dead &= (uint8_t)~bit;
+        if (source_dies && cfg_instruction_def(&x.inst) != s) x.dead |= bit;
+    }
+    w[0] = x;
+    return 1;
+}
+
+// a = b; b = a -> a = b
+static bool guard_copy_back(const PeepInst *w) {
+    return w[1].inst.rd == w[0].inst.rs1 && w[1].inst.rs1 == w[0].inst.rd;
+}
+
+static uint8_t rewrite_keep_first(PeepInst *w) {
+    (void)w;
+    return 1;
+}
+
+// a = b + i; c = a + j -> c = b + (i + j): a'nın ara değeri yalnızca ikinci talimatta kullanılır
+static bool guard_addi_chain(const PeepInst *w) {
+    Register a = w[0].inst.rd;
+    if (a == R_ZERO || w[1].inst.rs1 != a) return false;
+    if (!fits_imm12((int64_t)w[0].inst.immediate + w[1].inst.immediate)) return false;
+    return w[1].inst.rd == a || dead_after(&w[1], a);
+}
+
+static uint8_t rewrite_addi_chain(PeepInst *w) {
+    Instruction merged = {I_ADDI, w[1].inst.rd, w[0].inst.rs1, R_ZERO,
+                          w[0].inst.immediate + w[1].inst.immediate, SYMBOL_ID_NONE};
+    w[0] = (PeepInst){.inst = merged, .dead = 0, .is_volatile = false};
+    return 1;
+}
+
+// Aynı taban kaydı ve ofset (aynı MEM[] adresi), iki erişim de uçucu değil
+static bool same_address(const PeepInst *w) {
+    return w[0].inst.rs1 == w[1].inst.rs1 && w[0].inst.immediate == w[1].inst.immediate &&
+           !w[0].is_volatile && !w[1].is_volatile;
+}
+
+// MEM[x] = v; d = MEM[x] -> MEM[x] = v; d = v
+static uint8_t rewrite_store_load(PeepInst *w) {
+    Register v = w[0].inst.rs2, d = w[1].inst.rd;
+    if (d == v) return 1;
+    clear_dead(&w[0], v);
+    w[1] = (PeepInst){.inst = {I_ADD, d, v, R_ZERO, 0, SYMBOL_ID_NONE}, .dead = 0, .is_volatile = false};
+    return 2;
+}
+
+// a = MEM[x]; c = MEM[x] -> a = MEM[x]; c = a (ilk yükleme taban kaydını değiştirmemelidir)
+static bool guard_load_load(const PeepInst *w) {
+    return same_address(w) && w[0].inst.rd != w[0].inst.rs1 && w[0].inst.rd != R_ZERO;
+}
+
+static uint8_t rewrite_load_load(PeepInst *w) {
+    Register a = w[0].inst.rd, c = w[1].inst.rd;
+    if (c == a) return 1;
+    w[1] = (PeepInst){.inst = {I_ADD, c, a, R_ZERO, 0, SYMBOL_ID_NONE}, .dead = 0, .is_volatile = false};
+    return 2;
+}
+
+// Bcc L1; JAL x0, L2; L1: -> B!cc L2; L1:
+static bool guard_branch_over_jump(const PeepInst *w) {
+    return w[0].inst.label != SYMBOL_ID_NONE && w[0].inst.label == w[2].inst.label &&
+           w[1].inst.rd == R_ZERO && w[1].inst.label != SYMBOL_ID_NONE;
+}
+
+static uint8_t rewrite_branch_over_jump(PeepInst *w) {
+    w[0].inst.type = cfg_invert_branch(w[0].inst.type);
+    w[0].inst.label = w[1].inst.label;
+    w[1] = w[2];
+    return 2;
+}
+
+// JAL x0, L; L: -> L:  /  Bcc L; L: -> L:
+static bool guard_jump_to_next(const PeepInst *w) {
+    return w[0].inst.rd == R_ZERO && w[0].inst.label != SYMBOL_ID_NONE && w[0].inst.label == w[1].inst.label;
+}
+
+static uint8_t rewrite_drop_first(PeepInst *w) {
+    w[0] = w[1];
+    return 1;
+}
+
+static const PeepholeRule rules[] = {
+    {PEEP_COPY_FOLD,        "kopya-katlama",      2, {PEEP_COPY, PEEP_ANY},           guard_copy_fold,        rewrite_copy_fold},
+    {PEEP_COPY_BACK,        "geri-kopya",         2, {PEEP_COPY, PEEP_COPY},          guard_copy_back,        rewrite_keep_first},
+    {PEEP_ADDI_CHAIN,       "addi-zinciri",       2, {I_ADDI, I_ADDI},                guard_addi_chain,       rewrite_addi_chain},
+    {PEEP_STORE_LOAD,       "depo-yükleme",       2, {I_SW, I_LW},                    same_address,           rewrite_store_load},
+    {PEEP_LOAD_LOAD,        "yükleme-yükleme",    2, {I_LW, I_LW},                    guard_load_load,        rewrite_load_load},
+    {PEEP_BRANCH_OVER_JUMP, "dallanma-ters",      3, {PEEP_BRANCH, I_JAL, I_A_LABEL}, guard_branch_over_jump, rewrite_branch_over_jump},
+    {PEEP_JUMP_TO_NEXT,     "sonrakine-atlama",   2, {I_JAL, I_A_LABEL},              guard_jump_to_next,     rewrite_drop_first},
+    {PEEP_BRANCH_TO_NEXT,   "sonrakine-dallanma", 2, {PEEP_BRANCH, I_A_LABEL},        guard_jump_to_next,     rewrite_drop_first},
+};
+
+#define RULE_TABLE_SIZE (sizeof(rules) / sizeof(rules[0]))
+
+// --- Kural Dizini ---
+
+static bool element_matches(uint16_t element, const Instruction *inst) {
+    switch (element) {
+        case PEEP_ANY:    return inst->type != I_A_LABEL;
+        case PEEP_BRANCH: return cfg_is_branch(inst->type);
+        case PEEP_COPY:   return is_copy(inst);
+        default:          return element == inst->type;
+    }
+}
+
+// Son talimat tipi -> o tiple bitebilen kurallar (tablo sırasıyla)
+static const PeepholeRule *rule_index[I_A_LABEL + 1][RULE_TABLE_SIZE];
+static uint8_t rule_index_count[I_A_LABEL + 1];
+static bool rule_index_ready = false;
+
+static void build_rule_index(void) {
+    if (rule_index_ready) return;
+    for (size_t r = 0; r < RULE_TABLE_SIZE; r++) {
+        uint16_t last = rules[r].pattern[rules[r].length - 1];
+        for (uint32_t type = 0; type <= I_A_LABEL; type++) {
+            bool possible = last == PEEP_ANY    ? type != I_A_LABEL :
+                            last == PEEP_BRANCH ? cfg_is_branch((InstructionType)type) :
+                            last == PEEP_COPY   ? (type == I_ADD || type == I_ADDI) :
+                            last == type;
+            if (possible) rule_index[type][rule_index_count[type]++] = &rules[r];
+        }
+    }
+    rule_index_ready = true;
+}
+
+/**
+ * @brief Pencerenin sonuna uyan ilk kuralı uygular.
+ * @return true eğer bir kural uygulandıysa.
+ */
+static bool apply_rules(PeepInst *window, size_t *count, PeepholeStats *stats) {
+    size_t n = *count;
+    InstructionType last = window[n - 1].inst.type;
+    for (uint8_t k = 0; k < rule_index_count[last]; k++) {
+        const PeepholeRule *rule = rule_index[last][k];
+        if (rule->length > n) continue;
+        PeepInst *w = &window[n - rule->length];
+
+        bool matches = true;
+        for (uint8_t e = 0; e + 1 < rule->length && matches; e++) {
+            matches = element_matches(rule->pattern[e], &w[e].inst);
+        }
+        if (!matches || !element_matches(rule->pattern[rule->length - 1], &w[rule->length - 1].inst)) continue;
+        if (!rule->guard(w)) continue;
+
+        *count = n - rule->length + rule->rewrite(w);
+        stats->hits[rule->id]++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Her talimat için okuduğu sanal kayıtların talimattan sonra ölü olup olmadığını
+ * hesaplar ve uçucu bellek erişimlerini işaretler. Bloklar geriye doğru yalnızca blok içinde
+ * taranır: Talimattan sonra aynı blokta okunan veya yeniden tanımlanan kaydın durumu
+ * taramadan bilinir; blok sonuna kadar görülmeyen kayıt için blok sonu canlılığına bakılır.
+ */
+static void compute_dead_flags(const CodeBuffer *buffer, const VolatileMemory *volatile_memory, PeepInst *window) {
+    MemoryAccess *accesses = NULL;
+    if (volatile_memory != NULL && volatile_memory->count > 0) {
+        accesses = (MemoryAccess *)safe_malloc(buffer->count * sizeof(MemoryAccess));
+        memory_flow_classify(buffer, volatile_memory, accesses);
+    }
+
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+
+    // seen[r] == blok + 1: r bu blokta taranan kısımda görüldü, live[r] o noktadaki durumu
+    uint32_t *seen = (uint32_t *)safe_malloc(cfg->register_count * sizeof(uint32_t));
+    bool *live = (bool *)safe_malloc(cfg->register_count);
+    memset(seen, 0, cfg->register_count * sizeof(uint32_t));
+#define LIVE_AFTER(r) (seen[r] == stamp ? live[r] : cfg_set_contains(cfg, cfg_live_out(cfg, b), (r)))
+
+    for (size_t b = 0; b < cfg->block_count; b++) {
+        uint32_t stamp = (uint32_t)b + 1;
+        for (size_t i = cfg->blocks[b].end; i-- > cfg->blocks[b].start;) {
+            const Instruction *inst = &buffer->instructions[i];
+            uint8_t dead = 0;
+            if (REGISTER_IS_VIRTUAL(inst->rs1) && reads_slot(inst, 0) && !LIVE_AFTER(inst->rs1)) dead |= DEAD_RS1;
+            if (REGISTER_IS_VIRTUAL(inst->rs2) && reads_slot(inst, 1) && !LIVE_AFTER(inst->rs2)) dead |= DEAD_RS2;
+            window[i] = (PeepInst){.inst = *inst, .dead = dead,
+                                   .is_volatile = accesses != NULL && accesses[i].is_volatile};
+
+            Register def = cfg_instruction_def(inst);
+            if (def != R_ZERO) {
+                seen[def] = stamp;
+                live[def] = false;
+            }
+            Register uses[2];
+            int use_count = cfg_instruction_uses(inst, uses);
+            for (int u = 0; u < use_count; u++) {
+                seen[uses[u]] = stamp;
+                live[uses[u]] = true;
+            }
+        }
+    }
+#undef LIVE_AFTER
+
+    free(live);
+    free(seen);
+    free(accesses);
+    cfg_free(cfg);
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+size_t peephole_optimize(CodeBuffer *buffer, const VolatileMemory *volatile_memory, PeepholeStats *stats) {
+    if (buffer->count == 0) return 0;
+    build_rule_index();
+
+    PeepInst *window = (PeepInst *)safe_malloc(buffer->count * sizeof(PeepInst));
+    compute_dead_flags(buffer, volatile_memory, window);
+
+    // Pencere girişi yerinde sıkıştırılır: Çıktı (n) hiçbir zaman okunan talimatı (i) geçmez
+    size_t n = 0, rewrites = 0;
+    for (size_t i = 0; i < buffer->count; i++) {
+        window[n++] = window[i];
+        for (int retry = 0; retry < PEEPHOLE_MAX_RETRIES && n > 0; retry++) {
+            if (!apply_rules(window, &n, stats)) break;
+            rewrites++;
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) buffer->instructions[i] = window[i].inst;
+    buffer->count = n;
+    free(window);
+    return rewrites;
+}
+
+void peephole_print_stats(const PeepholeStats *stats) {
+    size_t total = 0;
+    for (size_t r = 0; r < RULE_TABLE_SIZE; r++) total += stats->hits[rules[r].id];
+    if (total == 0) return;
+
+    printf("Peephole: %zu yeniden yazma (", total);
+    bool first = true;
+    for (size_t r = 0; r < RULE_TABLE_SIZE; r++) {
+        if (stats->hits[rules[r].id] == 0) continue;
+        printf("%s%s: %zu", first ? "" : ", ", rules[r].name, stats->hits[rules[r].id]);
+        first = false;
+    }
+    printf(").\n");
+}
@@ -0,0 +1,52 @@
+#ifndef BESSAMBLY_PEEPHOLE_H
+#define BESSAMBLY_PEEPHOLE_H
+
+#include <stddef.h>
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+#include "memory_flow.h"  // VolatileMemory için
+
+/**
+ * @brief Gözetleme Deliği (Peephole) Optimizasyonu
+ * Talimatlar sırayla bir çıktı penceresine eklenir; her eklemede pencerenin sonundaki 2-4
+ * talimat kural tablosundaki kalıplarla karşılaştırılır. Kurallar kalıbın son talimatının
+ * tipine göre dizinlenir, bu yüzden bir talimat yalnızca onunla bitebilecek kurallara bakar ve
+ * geçiş doğrusal kalır. Eşleşen kuralın koruması (guard) sağlanırsa kalıp yerine kuralın
+ * ürettiği (daha kısa veya eşit uzunlukta) talimatlar konur ve yeni son tekrar denenir.
+ *
+ * Korumalar, geçişin başında blok canlılığından (cfg.c) hesaplanan "bu talimattan sonra ölü"
+ * bilgisini kullanır: Örneğin bir kopya yalnızca hedefi kullanıcısından sonra ölüyse katlanır.
+ */
+
+// Kural kimlikleri (isabet sayaçlarının dizini)
+typedef enum {
+    PEEP_COPY_FOLD,         // t = s; X(t)          -> X(s)             (t, X'ten sonra ölü)
+    PEEP_COPY_BACK,         // a = b; b = a         -> a = b
+    PEEP_ADDI_CHAIN,        // a = b + i; c = a + j -> c = b + (i + j)  (a ara değer)
+    PEEP_STORE_LOAD,        // MEM[x] = v; d = MEM[x] -> MEM[x] = v; d = v
+    PEEP_LOAD_LOAD,         // a = MEM[x]; c = MEM[x] -> a = MEM[x]; c = a
+    PEEP_BRANCH_OVER_JUMP,  // Bcc L1; J L2; L1:    -> B!cc L2; L1:
+    PEEP_JUMP_TO_NEXT,      // J L; L:              -> L:
+    PEEP_BRANCH_TO_NEXT,    // Bcc L; L:            -> L:
+    PEEPHOLE_RULE_COUNT
+} PeepholeRuleId;
+
+// Optimizasyon turları boyunca biriken kural isabetleri
+typedef struct {
+    size_t hits[PEEPHOLE_RULE_COUNT];
+} PeepholeStats;
+
+/**
+ * @brief Talimat arabelleğine gözetleme deliği kurallarını bir kez uygular.
+ * Yerleşimden önce (sanal kayıtlar ve I_A_LABEL ile) çalışır.
+ * @param volatile_memory: Uçucu bellek bölgeleri (NULL: yok); bunlara erişen talimatlar bellek kurallarına girmez.
+ * @param stats: Kural isabetlerinin ekleneceği sayaçlar.
+ * @return size_t: Uygulanan yeniden yazma sayısı.
+ */
+size_t peephole_optimize(CodeBuffer *buffer, const VolatileMemory *volatile_memory, PeepholeStats *stats);
+
+/**
+ * @brief İsabet alan kuralları ve sayılarını yazdırır.
+ */
+void peephole_print_stats(const PeepholeStats *stats);
+
+#endif // BESSAMBLY_PEEPHOLE_H
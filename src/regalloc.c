@@ -0,0 +1,1088 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "regalloc.h"
+#include "cfg.h"
+#include "isel.h"  // isel_constant_sequence için
+#include "error.h"
+#include "utils.h" // safe_malloc için
+
+// Taşma (spill) kodu için ayrılmış kayıtlar: Birinci kaynak ve hedef T5, ikinci kaynak T6
+#define SPILL_SCRATCH_REG_1 R_T5
+#define SPILL_SCRATCH_REG_2 R_T6
+
+// Taşma alanının taban kaydı: Program girişinde alan başlangıcı + SPILL_BASE_BIAS değerine
+// kurulur. İlk 1024 yuvaya 12-bit ofsetli tek LW/SW ile, sonrakilere LUI + ADD ile hesaplanan
+// adres üzerinden erişilir; yuva sayısının adres uzayı dışında bir sınırı yoktur.
+#define SPILL_BASE_REG  R_SP
+#define SPILL_BASE_BIAS 2048
+
+#define REGALLOC_UNASSIGNED (-1)
+#define REGALLOC_SPILLED    (-2)
+
+// Döngü derinliği ağırlığı için üst sınır (10^6 yeterince baskındır)
+#define REGALLOC_MAX_WEIGHT_DEPTH 6
+
+// Yeniden üretilebilir kayıtların taşıma ağırlığı çarpanı: Kullanım başına LW yerine 1-2 ALU
+// talimatı gerekir ve tanımlarının depolaması kalkar, bu yüzden önce onlar taşınır.
+#define REGALLOC_REMAT_WEIGHT 0.5
+
+// Atanabilir kayıtlar (tercih sırasıyla). Önce s/a kayıtları, ardından s0, ra, t3, t4.
+static const Register allocatable_registers[] = {
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    R_S0, R_RA, R_T3, R_T4
+};
+#define ALLOCATABLE_COUNT (sizeof(allocatable_registers) / sizeof(allocatable_registers[0]))
+
+// Bir sanal kaydın canlılık aralığı [start, end]. Konumlar talimat indeksinin iki katıdır:
+// i. talimatın okumaları 2i, yazması 2i+1 konumundadır. Böylece son okuması i. talimatta
+// olan kayıt, aynı talimatın hedefiyle kaydını paylaşabilir.
+typedef struct {
+    uint32_t vreg;   // Sanal kayıt numarası - R_VIRTUAL_BASE
+    size_t start;
+    size_t end;
+    double weight;   // Taşıma maliyeti: Her kullanım/tanım için 10^döngü_derinliği
+} LiveInterval;
+
+// --- Yardımcı İşlevler ---
+
+static double depth_weight(int depth) {
+    double weight = 1.0;
+    if (depth > REGALLOC_MAX_WEIGHT_DEPTH) depth = REGALLOC_MAX_WEIGHT_DEPTH;
+    for (int d = 0; d < depth; d++) weight *= 10.0;
+    return weight;
+}
+
+static void interval_extend(LiveInterval *interval, size_t position) {
+    if (position < interval->start) interval->start = position;
+    if (position > interval->end) interval->end = position;
+}
+
+static int compare_interval_start(const void *a, const void *b) {
+    const LiveInterval *x = (const LiveInterval *)a;
+    const LiveInterval *y = (const LiveInterval *)b;
+    if (x->start != y->start) return x->start < y->start ? -1 : 1;
+    return x->vreg < y->vreg ? -1 : (x->vreg > y->vreg);
+}
+
+/**
+ * @brief Her sanal kaydın canlılık aralığını ve taşıma ağırlığını hesaplar.
+ * Aralıklar kaba (delikleri olmayan) aralıklardır: Blok sınırlarında canlı olan kayıtlar
+ * bloğun başına/sonuna kadar uzatılır.
+ */
+static void build_intervals(const CodeBuffer *buffer, const ControlFlowGraph *cfg,
+                            LiveInterval *intervals, uint32_t vreg_count) {
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        intervals[v].vreg = v;
+        intervals[v].start = SIZE_MAX;
+        intervals[v].end = 0;
+        intervals[v].weight = 0.0;
+    }
+
+    for (size_t k = 0; k < cfg->block_count; k++) {
+        const BasicBlock *block = &cfg->blocks[k];
+        double weight = depth_weight(block->loop_depth);
+
+        for (size_t i = block->start; i < block->end; i++) {
+            const Instruction *inst = &buffer->instructions[i];
+            Register uses[2];
+            int use_count = cfg_instruction_uses(inst, uses);
+            for (int u = 0; u < use_count; u++) {
+                if (!REGISTER_IS_VIRTUAL(uses[u])) continue;
+                LiveInterval *interval = &intervals[uses[u] - R_VIRTUAL_BASE];
+                interval_extend(interval, 2 * i);
+                interval->weight += weight;
+            }
+            Register def = cfg_instruction_def(inst);
+            if (REGISTER_IS_VIRTUAL(def)) {
+                LiveInterval *interval = &intervals[def - R_VIRTUAL_BASE];
+                interval_extend(interval, 2 * i + 1);
+                interval->weight += weight;
+            }
+        }
+
+        // Blok girişinde/çıkışında canlı olan kayıtlar bloğun tamamını kapsar
+        const uint64_t *live_in = cfg_live_in(cfg, k);
+        const uint64_t *live_out = cfg_live_out(cfg, k);
+        for (uint32_t g = cfg_set_next(cfg, live_in, 0); g < cfg->global_count; g = cfg_set_next(cfg, live_in, g + 1)) {
+            Register r = cfg->global_registers[g];
+            if (REGISTER_IS_VIRTUAL(r)) interval_extend(&intervals[r - R_VIRTUAL_BASE], 2 * block->start);
+        }
+        for (uint32_t g = cfg_set_next(cfg, live_out, 0); g < cfg->global_count; g = cfg_set_next(cfg, live_out, g + 1)) {
+            Register r = cfg->global_registers[g];
+            if (REGISTER_IS_VIRTUAL(r)) interval_extend(&intervals[r - R_VIRTUAL_BASE], 2 * block->end);
+        }
+    }
+}
+
+/**
+ * @brief Doğrusal tarama (Poletto & Sarkar): Aralıklar başlangıç sırasıyla işlenir; boş kayıt
+ * yoksa etkin aralıklar ve mevcut aralık arasından ağırlığı en düşük olan taşınır.
+ * Böylece döngü içindeki kayıtlar (ağırlık 10^derinlik) kayıtta kalır.
+ */
+static void linear_scan(LiveInterval *intervals, size_t interval_count, int *assignment) {
+    LiveInterval *active[ALLOCATABLE_COUNT];
+    int active_slot[ALLOCATABLE_COUNT]; // Etkin aralığın kullandığı havuz indeksi
+    size_t active_count = 0;
+    bool pool_busy[ALLOCATABLE_COUNT] = {false};
+
+    for (size_t n = 0; n < interval_count; n++) {
+        LiveInterval *current = &intervals[n];
+
+        // 1. Sona ermiş aralıkların kayıtlarını serbest bırak
+        for (size_t a = 0; a < active_count;) {
+            if (active[a]->end < current->start) {
+                pool_busy[active_slot[a]] = false;
+                active[a] = active[active_count - 1];
+                active_slot[a] = active_slot[active_count - 1];
+                active_count--;
+            } else {
+                a++;
+            }
+        }
+
+        // 2. Boş kayıt varsa tercih sırasına göre ilkini ata
+        int free_slot = -1;
+        for (size_t p = 0; p < ALLOCATABLE_COUNT; p++) {
+            if (!pool_busy[p]) { free_slot = (int)p; break; }
+        }
+        if (free_slot >= 0) {
+            pool_busy[free_slot] = true;
+            assignment[current->vreg] = free_slot;
+            active[active_count] = current;
+            active_slot[active_count] = free_slot;
+            active_count++;
+            continue;
+        }
+
+        // 3. Kayıt baskısı: En düşük ağırlıklı etkin aralığı bul (eşitlikte en geç biteni)
+        size_t victim = 0;
+        for (size_t a = 1; a < active_count; a++) {
+            if (active[a]->weight < active[victim]->weight ||
+                (active[a]->weight == active[victim]->weight && active[a]->end > active[victim]->end)) {
+                victim = a;
+            }
+        }
+
+        if (active[victim]->weight < current->weight ||
+            (active[victim]->weight == current->weight && active[victim]->end > current->end)) {
+            // Kurbanın kaydını mevcut aralığa ver
+            assignment[current->vreg] = active_slot[victim];
+            assignment[active[victim]->vreg] = REGALLOC_SPILLED;
+            active[victim] = current;
+        } else {
+            assignment[current->vreg] = REGALLOC_SPILLED;
+        }
+    }
+}
+
+/**
+ * @brief Sabit atama: Aralıklar başlangıç sırasıyla işlenir ve her biri o anda boş olan ilk
+ * kayda atanır; aralığı biten sanal kaydın fiziksel kaydı sonraki aralıklara verilir. Boş kayıt
+ * yoksa aralık belleğe taşınır (doğrusal taramanın aksine kurban seçilmez).
+ * Yeniden üretilebilir kayıtlar (sabitler, bellek taban kayıtları) taşınmaları ucuz olduğundan
+ * ikinci turda, aralıkları boyunca boş kalan kayıtlara atanır.
+ */
+static void fixed_assignment(const LiveInterval *intervals, size_t interval_count, const uint8_t *remat, int *assignment) {
+    // 1. Tur: Kayıt, son atanan aralığı mevcut aralık başlamadan bittiyse boştur
+    size_t busy_until[ALLOCATABLE_COUNT];
+    size_t owned_count[ALLOCATABLE_COUNT] = {0};
+    for (size_t n = 0; n < interval_count; n++) {
+        const LiveInterval *current = &intervals[n];
+        if (remat[current->vreg]) continue;
+        assignment[current->vreg] = REGALLOC_SPILLED;
+        for (size_t p = 0; p < ALLOCATABLE_COUNT; p++) {
+            if (owned_count[p] > 0 && busy_until[p] >= current->start) continue;
+            busy_until[p] = current->end;
+            owned_count[p]++;
+            assignment[current->vreg] = (int)p;
+            break;
+        }
+    }
+
+    // 2. Tur: Kaydın birinci turdaki aralıkları başlangıç sırasıyla ve örtüşmeden dizilir.
+    // Mevcut aralık başlamadan bitmeyen ilk aralık, mevcut aralık bitmeden başlıyorsa kayıt doludur.
+    size_t owned_start[ALLOCATABLE_COUNT + 1];
+    owned_start[0] = 0;
+    for (size_t p = 0; p < ALLOCATABLE_COUNT; p++) owned_start[p + 1] = owned_start[p] + owned_count[p];
+    const LiveInterval **owned = (const LiveInterval **)safe_malloc((owned_start[ALLOCATABLE_COUNT] + 1) * sizeof(LiveInterval *));
+    size_t cursor[ALLOCATABLE_COUNT];
+    memcpy(cursor, owned_start, sizeof(cursor));
+    for (size_t n = 0; n < interval_count; n++) {
+        const LiveInterval *current = &intervals[n];
+        if (!remat[current->vreg] && assignment[current->vreg] >= 0) owned[cursor[assignment[current->vreg]]++] = current;
+    }
+    memcpy(cursor, owned_start, sizeof(cursor));
+
+    size_t remat_until[ALLOCATABLE_COUNT];
+    bool remat_used[ALLOCATABLE_COUNT] = {false};
+    for (size_t n = 0; n < interval_count; n++) {
+        const LiveInterval *current = &intervals[n];
+        if (!remat[current->vreg]) continue;
+        assignment[current->vreg] = REGALLOC_SPILLED;
+        for (size_t p = 0; p < ALLOCATABLE_COUNT; p++) {
+            while (cursor[p] < owned_start[p + 1] && owned[cursor[p]]->end < current->start) cursor[p]++;
+            if (cursor[p] < owned_start[p + 1] && owned[cursor[p]]->start <= current->end) continue;
+            if (remat_used[p] && remat_until[p] >= current->start) continue;
+            remat_used[p] = true;
+            remat_until[p] = current->end;
+            assignment[current->vreg] = (int)p;
+            break;
+        }
+    }
+    free(owned);
+}
+
+/**
+ * @brief Sanal kayıtların aralıklarını hesaplar, kullanılmayan numaraları (etiket kimlikleri vb.)
+ * eler ve aralıkları başlangıca göre sıralar.
+ * @return LiveInterval*: Sıralı aralıklar (çağıran serbest bırakır).
+ */
+static LiveInterval *sorted_intervals(const CodeBuffer *buffer, uint32_t vreg_count, const uint8_t *remat,
+                                      size_t *interval_count) {
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+
+    LiveInterval *intervals = (LiveInterval *)safe_malloc(vreg_count * sizeof(LiveInterval));
+    build_intervals(buffer, cfg, intervals, vreg_count);
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (remat[v]) intervals[v].weight *= REGALLOC_REMAT_WEIGHT;
+    }
+    cfg_free(cfg);
+
+    size_t count = 0;
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (intervals[v].start != SIZE_MAX) intervals[count++] = intervals[v];
+    }
+    qsort(intervals, count, sizeof(LiveInterval), compare_interval_start);
+    *interval_count = count;
+    return intervals;
+}
+
+// Taşma yuvası yığını: Etkin yuvalar aralık sonuna göre min-yığında tutulur
+typedef struct {
+    size_t end;
+    uint32_t slot;
+} ActiveSlot;
+
+static void slot_heap_push(ActiveSlot *heap, size_t *count, ActiveSlot item) {
+    size_t i = (*count)++;
+    while (i > 0 && heap[(i - 1) / 2].end > item.end) {
+        heap[i] = heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap[i] = item;
+}
+
+static ActiveSlot slot_heap_pop(ActiveSlot *heap, size_t *count) {
+    ActiveSlot top = heap[0];
+    ActiveSlot last = heap[--(*count)];
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= *count) break;
+        if (child + 1 < *count && heap[child + 1].end < heap[child].end) child++;
+        if (heap[child].end >= last.end) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (*count > 0) heap[i] = last;
+    return top;
+}
+
+/**
+ * @brief Taşma yuvasına erişen LW/SW talimatlarını üretir.
+ * Ofset 12 bite sığmıyorsa adres önce address_reg'de hesaplanır (LUI + ADD).
+ * @return int: Üretilen talimat sayısı (1 veya 3).
+ */
+static int emit_spill_access(InstructionType type, Register value, Register address_reg, int32_t offset,
+                             Instruction *out) {
+    int32_t low = (int32_t)(((uint32_t)offset & 0xFFFu) ^ 0x800u) - 0x800;
+    int32_t upper = (int32_t)(((uint32_t)offset - (uint32_t)low) >> 12);
+    int n = 0;
+    Register base = SPILL_BASE_REG;
+    if (upper != 0) {
+        out[n++] = (Instruction){I_LUI, address_reg, R_ZERO, R_ZERO, upper, SYMBOL_ID_NONE};
+        out[n++] = (Instruction){I_ADD, address_reg, address_reg, SPILL_BASE_REG, 0, SYMBOL_ID_NONE};
+        base = address_reg;
+    }
+    if (type == I_LW) {
+        out[n++] = (Instruction){I_LW, value, base, R_ZERO, low, SYMBOL_ID_NONE};
+    } else {
+        out[n++] = (Instruction){I_SW, R_ZERO, base, value, low, SYMBOL_ID_NONE};
+    }
+    return n;
+}
+
+/**
+ * @brief Taşınan kayıtlara yuva atar: Aralıkları örtüşmeyen kayıtlar aynı yuvayı paylaşır.
+ * Birleştirilen kayıtlar temsilcinin yuvasını kullanır; temsilcinin aralığı tüm üyelerinkini
+ * kapsar. Aralıklar başlangıç sırasıyla işlenir, biten aralıkların yuvaları yeniden kullanılır.
+ * @param slot: Çıktı; taşınan (yeniden üretilmeyen) kaydın yuva numarası.
+ * @return size_t: Kullanılan yuva sayısı.
+ */
+static size_t assign_spill_slots(const CodeBuffer *buffer, uint32_t vreg_count, const int *assignment,
+                                 const uint8_t *remat, const uint32_t *alias, uint32_t *slot) {
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+    LiveInterval *intervals = (LiveInterval *)safe_malloc(vreg_count * sizeof(LiveInterval));
+    build_intervals(buffer, cfg, intervals, vreg_count);
+    cfg_free(cfg);
+
+    // Üyelerin aralıklarını temsilcide birleştir ve temsilcileri başlangıca göre sırala
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (assignment[v] != REGALLOC_SPILLED || remat[v] || alias[v] == v || intervals[v].start == SIZE_MAX) continue;
+        interval_extend(&intervals[alias[v]], intervals[v].start);
+        interval_extend(&intervals[alias[v]], intervals[v].end);
+    }
+    size_t count = 0;
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (assignment[v] == REGALLOC_SPILLED && !remat[v] && alias[v] == v && intervals[v].start != SIZE_MAX) {
+            intervals[count++] = intervals[v];
+        }
+    }
+    qsort(intervals, count, sizeof(LiveInterval), compare_interval_start);
+
+    ActiveSlot *active = (ActiveSlot *)safe_malloc((count + 1) * sizeof(ActiveSlot));
+    uint32_t *free_slots = (uint32_t *)safe_malloc((count + 1) * sizeof(uint32_t));
+    size_t active_count = 0, free_count = 0;
+    uint32_t slot_count = 0;
+    for (size_t n = 0; n < count; n++) {
+        const LiveInterval *current = &intervals[n];
+        while (active_count > 0 && active[0].end < current->start) {
+            free_slots[free_count++] = slot_heap_pop(active, &active_count).slot;
+        }
+        uint32_t s = free_count > 0 ? free_slots[--free_count] : slot_count++;
+        slot[current->vreg] = s;
+        slot_heap_push(active, &active_count, (ActiveSlot){current->end, s});
+    }
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (assignment[v] == REGALLOC_SPILLED && !remat[v] && alias[v] != v) slot[v] = slot[alias[v]];
+    }
+
+    free(free_slots);
+    free(active);
+    free(intervals);
+    return slot_count;
+}
+
+// --- Yeniden Üretme (Rematerialization) ---
+
+/**
+ * @brief Değeri sabit olan sanal kayıtları bulur.
+ * Bir kaydın tüm tanımları aynı sabiti yüklüyorsa (ADDI v, x0, k / LUI v, üst [+ ADDI v, v, alt])
+ * kayıt belleğe taşınmak yerine her kullanımdan önce yeniden üretilebilir: Tanımları silinir,
+ * depolama ve taşma yuvası gerekmez. Komut seçicinin büyük sabit kayıtları bu biçimdedir.
+ * @param constant: Çıktı; yeniden üretilebilir kayıtların değeri.
+ * @return uint8_t*: Kayıt başına yeniden üretilebilirlik bayrağı (çağıran serbest bırakır).
+ */
+static uint8_t *find_rematerializable(const CodeBuffer *buffer, uint32_t vreg_count, int32_t *constant) {
+    enum { REMAT_NO = 0, REMAT_YES = 1, REMAT_UNSEEN = 2 };
+    uint8_t *remat = (uint8_t *)safe_malloc(vreg_count + 1);
+    memset(remat, REMAT_UNSEEN, vreg_count + 1);
+
+    for (size_t i = 0; i < buffer->count; i++) {
+        const Instruction *inst = &buffer->instructions[i];
+        Register def = cfg_instruction_def(inst);
+        if (!REGISTER_IS_VIRTUAL(def)) continue;
+        uint32_t v = def - R_VIRTUAL_BASE;
+
+        int32_t value;
+        if (inst->type == I_ADDI && inst->rs1 == R_ZERO) {
+            value = inst->immediate;
+        } else if (inst->type == I_LUI) {
+            value = (int32_t)((uint32_t)inst->immediate << 12);
+            const Instruction *next = (i + 1 < buffer->count) ? &buffer->instructions[i + 1] : NULL;
+            if (next != NULL && next->type == I_ADDI && next->rd == def && next->rs1 == def) {
+                value = (int32_t)((uint32_t)value + (uint32_t)next->immediate);
+                i++; // Çiftin ADDI'si tanımın parçasıdır
+            }
+        } else {
+            remat[v] = REMAT_NO;
+            continue;
+        }
+
+        if (remat[v] == REMAT_UNSEEN) {
+            remat[v] = REMAT_YES;
+            constant[v] = value;
+        } else if (remat[v] == REMAT_YES && constant[v] != value) {
+            remat[v] = REMAT_NO;
+        }
+    }
+
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (remat[v] == REMAT_UNSEEN) remat[v] = REMAT_NO;
+    }
+    return remat;
+}
+
+// --- Çizge Boyama (Chaitin/Briggs) ---
+
+/**
+ * @brief Talimatın bir kayıt kopyası olup olmadığını kontrol eder (ADD rd, rs, x0 / ADDI rd, rs, 0).
+ */
+static bool is_register_copy(const Instruction *inst) {
+    if (inst->rs1 == R_ZERO) return false;
+    return (inst->type == I_ADD && inst->rs2 == R_ZERO) ||
+           (inst->type == I_ADDI && inst->immediate == 0);
+}
+
+// İfade geçicisinin (T0/T1) blok içindeki bekleyen kopyası
+typedef struct {
+    size_t copy_index; // Kopya talimatı (SIZE_MAX: yok)
+    Register source;   // Kopyalanan sanal kayıt
+    bool valid;        // Kaynak kopyadan sonra değişmediyse true
+    bool kept;         // Yerine konamayan bir kullanım varsa kopya korunur
+} TempCopy;
+
+static size_t finalize_temp_copy(TempCopy *copy, uint8_t *remove) {
+    size_t removed = 0;
+    if (copy->copy_index != SIZE_MAX && !copy->kept) {
+        remove[copy->copy_index] = 1;
+        removed = 1;
+    }
+    copy->copy_index = SIZE_MAX;
+    return removed;
+}
+
+/**
+ * @brief İfade geçicilerine yapılan kopyaları kaynak kayıtlarıyla birleştirir.
+ * Seçici operantları yerinde kullandığından T0/T1'e kopyayı yalnızca iki kaynak üretir:
+ * Yardımcı rutin çağrılarının (I_A_CALL) argümanları ve MEM[] veri akışının bir geçiciye
+ * yüklemeyi depolanan kaydın kopyasına çevirmesi (LW t0, ... -> ADD t0, vA, x0; bkz.
+ * memory_flow.h). Geçici kayıtlar blok dışına taşmadığından birleştirme yerel olarak
+ * yapılır: Kaynak değişmediği sürece geçicinin kullanımları kaynak kayıtla değiştirilir ve
+ * kopya silinir. Çağrılar argümanlarını T0/T1'de beklediğinden onlara yapılan kopyalar korunur.
+ * @return size_t: Kaldırılan kopya sayısı.
+ */
+static size_t coalesce_expression_temporaries(CodeBuffer *buffer, const ControlFlowGraph *cfg) {
+    static const Register temps[2] = {R_T0, R_T1};
+    Instruction *instructions = buffer->instructions;
+    uint8_t *remove = (uint8_t *)safe_malloc(buffer->count + 1);
+    memset(remove, 0, buffer->count + 1);
+    size_t removed = 0;
+
+    for (size_t k = 0; k < cfg->block_count; k++) {
+        TempCopy state[2] = {{SIZE_MAX, R_ZERO, false, false}, {SIZE_MAX, R_ZERO, false, false}};
+
+        for (size_t i = cfg->blocks[k].start; i < cfg->blocks[k].end; i++) {
+            Instruction *inst = &instructions[i];
+
+            // 1. Kullanımlar: Geçerli bir kopya varsa geçiciyi kaynakla değiştir
+            Register uses[2];
+            int use_count = cfg_instruction_uses(inst, uses);
+            for (int t = 0; t < 2; t++) {
+                bool used = false;
+                for (int u = 0; u < use_count; u++) used |= (uses[u] == temps[t]);
+                if (!used || state[t].copy_index == SIZE_MAX) continue;
+                if (state[t].valid && inst->type != I_A_CALL) {
+                    if (inst->rs1 == temps[t]) inst->rs1 = state[t].source;
+                    if (inst->rs2 == temps[t]) inst->rs2 = state[t].source;
+                } else {
+                    state[t].kept = true;
+                }
+            }
+
+            // 2. Tanım: Kaynağı değişen kopyalar geçersizleşir, geçiciye yazılan yeni kopya kaydedilir
+            Register def = cfg_instruction_def(inst);
+            if (def == R_ZERO) continue;
+            for (int t = 0; t < 2; t++) {
+                if (state[t].copy_index != SIZE_MAX && state[t].source == def) state[t].valid = false;
+            }
+            for (int t = 0; t < 2; t++) {
+                if (def != temps[t]) continue;
+                removed += finalize_temp_copy(&state[t], remove);
+                if (is_register_copy(inst) && REGISTER_IS_VIRTUAL(inst->rs1)) {
+                    state[t] = (TempCopy){i, inst->rs1, true, false};
+                }
+            }
+        }
+
+        // Blok sonunda canlı kalan geçicinin kopyası korunur
+        for (int t = 0; t < 2; t++) {
+            if (state[t].copy_index != SIZE_MAX && cfg_set_contains(cfg, cfg_live_out(cfg, k), temps[t])) state[t].kept = true;
+            removed += finalize_temp_copy(&state[t], remove);
+        }
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < buffer->count; i++) {
+        if (!remove[i]) instructions[n++] = instructions[i];
+    }
+    buffer->count = n;
+    free(remove);
+    return removed;
+}
+
+// Girişim çizgesi: Düğümler sanal kayıtlardır; birleştirilen düğümler alias ile temsilcisine bağlanır
+typedef struct {
+    uint32_t node_count;
+    uint32_t **adjacency;        // Komşu listeleri (birleştirme sonrası eski düğümler içerebilir)
+    uint32_t *adjacency_count;
+    uint32_t *adjacency_capacity;
+    uint32_t *degree;            // Temsilci komşu sayısı
+    uint32_t *alias;             // Birleşim-bul (union-find) dizisi
+    double *cost;                // Döngü ağırlıklı taşıma maliyeti
+    uint8_t *present;            // Kodda geçen sanal kayıtlar
+
+    uint64_t *edges;             // Kenar kümesi (açık adresleme, 0: boş yuva)
+    size_t edge_mask;
+    size_t edge_count;
+
+    uint32_t *stamp;             // Komşu tekilleştirme işaretleri
+    uint32_t current_stamp;
+} InterferenceGraph;
+
+// Kayıt kopyası: Birleştirme adayı
+typedef struct {
+    uint32_t dest;
+    uint32_t source;
+    double weight;
+} CopyPair;
+
+static uint32_t graph_find(InterferenceGraph *graph, uint32_t node) {
+    while (graph->alias[node] != node) {
+        graph->alias[node] = graph->alias[graph->alias[node]]; // Yol yarılama
+        node = graph->alias[node];
+    }
+    return node;
+}
+
+static uint64_t edge_key(uint32_t a, uint32_t b) {
+    if (a > b) { uint32_t t = a; a = b; b = t; }
+    return (((uint64_t)a << 32) | b) + 1;
+}
+
+static size_t edge_slot(const InterferenceGraph *graph, uint64_t key) {
+    size_t slot = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & graph->edge_mask;
+    while (graph->edges[slot] != 0 && graph->edges[slot] != key) {
+        slot = (slot + 1) & graph->edge_mask;
+    }
+    return slot;
+}
+
+static bool graph_has_edge(const InterferenceGraph *graph, uint32_t a, uint32_t b) {
+    uint64_t key = edge_key(a, b);
+    return graph->edges[edge_slot(graph, key)] == key;
+}
+
+static void adjacency_append(InterferenceGraph *graph, uint32_t node, uint32_t neighbor) {
+    if (graph->adjacency_count[node] == graph->adjacency_capacity[node]) {
+        uint32_t capacity = graph->adjacency_capacity[node] ? graph->adjacency_capacity[node] * 2 : 8;
+        graph->adjacency[node] = (uint32_t *)safe_realloc(graph->adjacency[node], capacity * sizeof(uint32_t));
+        graph->adjacency_capacity[node] = capacity;
+    }
+    graph->adjacency[node][graph->adjacency_count[node]++] = neighbor;
+}
+
+static void graph_add_edge(InterferenceGraph *graph, uint32_t a, uint32_t b) {
+    if (a == b) return;
+    uint64_t key = edge_key(a, b);
+    size_t slot = edge_slot(graph, key);
+    if (graph->edges[slot] == key) return;
+
+    graph->edges[slot] = key;
+    graph->edge_count++;
+    adjacency_append(graph, a, b);
+    adjacency_append(graph, b, a);
+    graph->degree[a]++;
+    graph->degree[b]++;
+
+    // Doluluk oranı 1/2'yi geçerse kenar tablosunu büyüt
+    if (graph->edge_count * 2 > graph->edge_mask + 1) {
+        uint64_t *old = graph->edges;
+        size_t old_slots = graph->edge_mask + 1;
+        graph->edge_mask = old_slots * 2 - 1;
+        graph->edges = (uint64_t *)safe_malloc(old_slots * 2 * sizeof(uint64_t));
+        memset(graph->edges, 0, old_slots * 2 * sizeof(uint64_t));
+        for (size_t s = 0; s < old_slots; s++) {
+            if (old[s] != 0) graph->edges[edge_slot(graph, old[s])] = old[s];
+        }
+        free(old);
+    }
+}
+
+static void graph_init(InterferenceGraph *graph, uint32_t node_count) {
+    graph->node_count = node_count;
+    graph->adjacency = (uint32_t **)safe_malloc(node_count * sizeof(uint32_t *));
+    graph->adjacency_count = (uint32_t *)safe_malloc(node_count * sizeof(uint32_t));
+    graph->adjacency_capacity = (uint32_t *)safe_malloc(node_count * sizeof(uint32_t));
+    graph->degree = (uint32_t *)safe_malloc(node_count * sizeof(uint32_t));
+    graph->alias = (uint32_t *)safe_malloc(node_count * sizeof(uint32_t));
+    graph->cost = (double *)safe_malloc(node_count * sizeof(double));
+    graph->present = (uint8_t *)safe_malloc(node_count);
+    graph->stamp = (uint32_t *)safe_malloc(node_count * sizeof(uint32_t));
+    for (uint32_t v = 0; v < node_count; v++) {
+        graph->adjacency[v] = NULL;
+        graph->adjacency_count[v] = 0;
+        graph->adjacency_capacity[v] = 0;
+        graph->degree[v] = 0;
+        graph->alias[v] = v;
+        graph->cost[v] = 0.0;
+        graph->present[v] = 0;
+        graph->stamp[v] = 0;
+    }
+    graph->current_stamp = 0;
+
+    graph->edge_mask = 1024 - 1;
+    graph->edges = (uint64_t *)safe_malloc((graph->edge_mask + 1) * sizeof(uint64_t));
+    memset(graph->edges, 0, (graph->edge_mask + 1) * sizeof(uint64_t));
+    graph->edge_count = 0;
+}
+
+static void graph_free(InterferenceGraph *graph) {
+    for (uint32_t v = 0; v < graph->node_count; v++) free(graph->adjacency[v]);
+    free(graph->adjacency);
+    free(graph->adjacency_count);
+    free(graph->adjacency_capacity);
+    free(graph->degree);
+    free(graph->alias);
+    free(graph->cost);
+    free(graph->present);
+    free(graph->stamp);
+    free(graph->edges);
+}
+
+/**
+ * @brief Girişim çizgesini ve kopya listesini oluşturur.
+ * Her blok, canlı çıkış kümesinden başlayarak geriye doğru dolaşılır; her tanım o noktada
+ * canlı olan tüm kayıtlarla girişir. Kopyalarda (d = s) kaynak girişim dışında tutulur ki
+ * d ve s birleştirilebilsin (Chaitin).
+ */
+static CopyPair *build_interference(InterferenceGraph *graph, const CodeBuffer *buffer,
+                                    const ControlFlowGraph *cfg, size_t *copy_count) {
+    size_t copy_capacity = 64;
+    CopyPair *copies = (CopyPair *)safe_malloc(copy_capacity * sizeof(CopyPair));
+    *copy_count = 0;
+
+    // Seyrek küme (sparse set): O(1) ekleme/çıkarma ve üyeler üzerinde dolaşma
+    uint32_t *dense = (uint32_t *)safe_malloc((graph->node_count + 1) * sizeof(uint32_t));
+    uint32_t *sparse = (uint32_t *)safe_malloc((graph->node_count + 1) * sizeof(uint32_t));
+    uint32_t live_count = 0;
+#define LIVE_HAS(v) (sparse[v] < live_count && dense[sparse[v]] == (v))
+#define LIVE_ADD(v) do { if (!LIVE_HAS(v)) { sparse[v] = live_count; dense[live_count++] = (v); } } while (0)
+#define LIVE_REMOVE(v) do { if (LIVE_HAS(v)) { uint32_t last_ = dense[--live_count]; dense[sparse[v]] = last_; sparse[last_] = sparse[v]; } } while (0)
+    memset(sparse, 0xFF, (graph->node_count + 1) * sizeof(uint32_t));
+
+    for (size_t k = 0; k < cfg->block_count; k++) {
+        const BasicBlock *block = &cfg->blocks[k];
+        double weight = depth_weight(block->loop_depth);
+
+        live_count = 0;
+        const uint64_t *live_out = cfg_live_out(cfg, k);
+        for (uint32_t g = cfg_set_next(cfg, live_out, 0); g < cfg->global_count; g = cfg_set_next(cfg, live_out, g + 1)) {
+            Register r = cfg->global_registers[g];
+            if (REGISTER_IS_VIRTUAL(r)) LIVE_ADD(r - R_VIRTUAL_BASE);
+        }
+
+        for (size_t i = block->end; i-- > block->start;) {
+            const Instruction *inst = &buffer->instructions[i];
+            Register def = cfg_instruction_def(inst);
+
+            if (REGISTER_IS_VIRTUAL(def)) {
+                uint32_t d = def - R_VIRTUAL_BASE;
+                uint32_t copy_source = UINT32_MAX;
+                if (is_register_copy(inst) && REGISTER_IS_VIRTUAL(inst->rs1)) {
+                    copy_source = inst->rs1 - R_VIRTUAL_BASE;
+                    if (*copy_count == copy_capacity) {
+                        copy_capacity *= 2;
+                        copies = (CopyPair *)safe_realloc(copies, copy_capacity * sizeof(CopyPair));
+                    }
+                    copies[(*copy_count)++] = (CopyPair){d, copy_source, weight};
+                }
+                for (uint32_t m = 0; m < live_count; m++) {
+                    if (dense[m] != d && dense[m] != copy_source) graph_add_edge(graph, d, dense[m]);
+                }
+                LIVE_REMOVE(d);
+                graph->present[d] = 1;
+                graph->cost[d] += weight;
+            }
+
+            Register uses[2];
+            int use_count = cfg_instruction_uses(inst, uses);
+            for (int u = 0; u < use_count; u++) {
+                if (!REGISTER_IS_VIRTUAL(uses[u])) continue;
+                uint32_t v = uses[u] - R_VIRTUAL_BASE;
+                LIVE_ADD(v);
+                graph->present[v] = 1;
+                graph->cost[v] += weight;
+            }
+        }
+    }
+#undef LIVE_HAS
+#undef LIVE_ADD
+#undef LIVE_REMOVE
+
+    free(sparse);
+    free(dense);
+    return copies;
+}
+
+static int compare_copy_weight(const void *a, const void *b) {
+    double x = ((const CopyPair *)a)->weight, y = ((const CopyPair *)b)->weight;
+    return (x < y) - (x > y); // Azalan sıra: sıcak kopyalar önce birleştirilir
+}
+
+/**
+ * @brief Briggs ölçütü: Birleşik düğümün derecesi K veya üzeri olan komşu sayısı K'dan azsa
+ * birleştirme çizgenin boyanabilirliğini bozmaz.
+ */
+static bool briggs_can_coalesce(InterferenceGraph *graph, uint32_t a, uint32_t b) {
+    uint32_t significant = 0;
+    uint32_t stamp = ++graph->current_stamp;
+    uint32_t nodes[2] = {a, b};
+    for (int n = 0; n < 2; n++) {
+        uint32_t node = nodes[n];
+        for (uint32_t e = 0; e < graph->adjacency_count[node]; e++) {
+            uint32_t t = graph_find(graph, graph->adjacency[node][e]);
+            if (t == a || t == b || graph->stamp[t] == stamp) continue;
+            graph->stamp[t] = stamp;
+            uint32_t degree = graph->degree[t];
+            if (graph_has_edge(graph, a, t) && graph_has_edge(graph, b, t)) degree--; // İki komşu teke iner
+            if (degree >= ALLOCATABLE_COUNT && ++significant >= ALLOCATABLE_COUNT) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief b düğümünü a'ya birleştirir: b'nin komşuları a'nın komşusu olur.
+ */
+static void graph_merge(InterferenceGraph *graph, uint32_t a, uint32_t b) {
+    graph->alias[b] = a;
+    graph->cost[a] += graph->cost[b];
+
+    uint32_t stamp = ++graph->current_stamp;
+    for (uint32_t e = 0; e < graph->adjacency_count[b]; e++) {
+        uint32_t t = graph_find(graph, graph->adjacency[b][e]);
+        if (t == a || graph->stamp[t] == stamp) continue;
+        graph->stamp[t] = stamp;
+        graph_add_edge(graph, a, t); // Kenar zaten varsa değişiklik olmaz
+        graph->degree[t]--;          // t, komşusu b'yi kaybetti
+    }
+}
+
+/**
+ * @brief Kopyaları tutucu (conservative) şekilde birleştirir; değişiklik kalmayana kadar tekrarlar.
+ * @return size_t: Birleştirilen kopya sayısı.
+ */
+static size_t coalesce_copies(InterferenceGraph *graph, CopyPair *copies, size_t copy_count) {
+    qsort(copies, copy_count, sizeof(CopyPair), compare_copy_weight);
+
+    size_t merged = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t c = 0; c < copy_count; c++) {
+            uint32_t a = graph_find(graph, copies[c].dest);
+            uint32_t b = graph_find(graph, copies[c].source);
+            if (a == b || graph_has_edge(graph, a, b)) continue;
+            if (!briggs_can_coalesce(graph, a, b)) continue;
+            graph_merge(graph, a, b);
+            merged++;
+            changed = true;
+        }
+    }
+    return merged;
+}
+
+/**
+ * @brief Basitleştir/seç (simplify/select) aşamaları. Derecesi K'dan küçük düğümler yığına
+ * alınır; hiç kalmazsa maliyet/derece oranı en küçük düğüm iyimser olarak (Briggs) yığına
+ * alınır. Yığından çıkarılırken renk bulunamayan düğümler belleğe taşınır.
+ */
+static void color_graph(InterferenceGraph *graph, int *color) {
+    uint32_t node_count = graph->node_count;
+    uint8_t *removed = (uint8_t *)safe_malloc(node_count + 1);
+    uint32_t *low = (uint32_t *)safe_malloc((node_count + 1) * sizeof(uint32_t));
+    uint32_t *select_stack = (uint32_t *)safe_malloc((node_count + 1) * sizeof(uint32_t));
+    size_t low_count = 0, select_count = 0, remaining = 0;
+
+    for (uint32_t v = 0; v < node_count; v++) {
+        bool is_node = graph->present[v] && graph_find(graph, v) == v;
+        removed[v] = !is_node;
+        color[v] = REGALLOC_UNASSIGNED;
+        if (!is_node) continue;
+        remaining++;
+        if (graph->degree[v] < ALLOCATABLE_COUNT) low[low_count++] = v;
+    }
+
+    while (remaining > 0) {
+        uint32_t node = UINT32_MAX;
+        while (low_count > 0 && node == UINT32_MAX) {
+            uint32_t candidate = low[--low_count];
+            if (!removed[candidate]) node = candidate;
+        }
+        if (node == UINT32_MAX) {
+            // Taşıma adayı: maliyet / derece en küçük olan
+            double best = 0.0;
+            for (uint32_t v = 0; v < node_count; v++) {
+                if (removed[v]) continue;
+                double score = graph->cost[v] / (double)(graph->degree[v] + 1);
+                if (node == UINT32_MAX || score < best) { node = v; best = score; }
+            }
+        }
+
+        removed[node] = 1;
+        remaining--;
+        select_stack[select_count++] = node;
+
+        uint32_t stamp = ++graph->current_stamp;
+        for (uint32_t e = 0; e < graph->adjacency_count[node]; e++) {
+            uint32_t t = graph_find(graph, graph->adjacency[node][e]);
+            if (removed[t] || graph->stamp[t] == stamp) continue;
+            graph->stamp[t] = stamp;
+            if (graph->degree[t]-- == ALLOCATABLE_COUNT) low[low_count++] = t;
+        }
+    }
+
+    while (select_count > 0) {
+        uint32_t node = select_stack[--select_count];
+        bool used[ALLOCATABLE_COUNT] = {false};
+        for (uint32_t e = 0; e < graph->adjacency_count[node]; e++) {
+            int c = color[graph_find(graph, graph->adjacency[node][e])];
+            if (c >= 0) used[c] = true;
+        }
+        color[node] = REGALLOC_SPILLED;
+        for (size_t c = 0; c < ALLOCATABLE_COUNT; c++) {
+            if (!used[c]) { color[node] = (int)c; break; }
+        }
+    }
+
+    free(select_stack);
+    free(low);
+    free(removed);
+}
+
+/**
+ * @brief Çizge boyama ile kayıt ataması.
+ * @param remat: Yeniden üretilebilir kayıtlar (taşıma maliyetleri düşürülür).
+ * @param alias: Çıktı; her sanal kaydın birleştirildiği temsilci.
+ * @return size_t: Kaldırılan ifade geçicisi kopyası sayısı.
+ */
+static size_t graph_coloring(CodeBuffer *buffer, uint32_t vreg_count, const uint8_t *remat,
+                             int *assignment, uint32_t *alias) {
+    // 1. İfade geçicilerinin kopyalarını yerel olarak birleştir (CFG yeniden kurulur)
+    ControlFlowGraph *cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+    size_t temp_copies = coalesce_expression_temporaries(buffer, cfg);
+    cfg_free(cfg);
+
+    cfg = cfg_build(buffer);
+    cfg_compute_liveness(cfg, buffer);
+
+    // 2. Çizge, birleştirme ve boyama
+    InterferenceGraph graph;
+    graph_init(&graph, vreg_count);
+    size_t copy_count = 0;
+    CopyPair *copies = build_interference(&graph, buffer, cfg, &copy_count);
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (remat[v]) graph.cost[v] *= REGALLOC_REMAT_WEIGHT;
+    }
+    coalesce_copies(&graph, copies, copy_count);
+
+    int *color = (int *)safe_malloc(vreg_count * sizeof(int));
+    color_graph(&graph, color);
+
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        uint32_t rep = graph_find(&graph, v);
+        alias[v] = rep;
+        assignment[v] = graph.present[v] ? color[rep] : REGALLOC_UNASSIGNED;
+    }
+
+    free(color);
+    free(copies);
+    graph_free(&graph);
+    cfg_free(cfg);
+    return temp_copies;
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+bool allocate_registers(CodeBuffer *buffer, RegAllocStrategy strategy) {
+    // Sanal kayıt numaralarının üst sınırı
+    uint32_t max_register = 0;
+    for (size_t i = 0; i < buffer->count; i++) {
+        const Instruction *inst = &buffer->instructions[i];
+        if ((uint32_t)inst->rd > max_register) max_register = inst->rd;
+        if ((uint32_t)inst->rs1 > max_register) max_register = inst->rs1;
+        if ((uint32_t)inst->rs2 > max_register) max_register = inst->rs2;
+    }
+    if (!REGISTER_IS_VIRTUAL(max_register)) {
+        return true; // Atanacak sanal kayıt yok
+    }
+
+    uint32_t vreg_count = max_register - R_VIRTUAL_BASE + 1;
+    int *assignment = (int *)safe_malloc(vreg_count * sizeof(int));
+    uint32_t *alias = (uint32_t *)safe_malloc(vreg_count * sizeof(uint32_t));
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        assignment[v] = REGALLOC_UNASSIGNED;
+        alias[v] = v;
+    }
+
+    // Değeri sabit olan kayıtlar taşındıklarında yeniden üretilir
+    int32_t *constant = (int32_t *)safe_malloc(vreg_count * sizeof(int32_t));
+    uint8_t *remat = find_rematerializable(buffer, vreg_count, constant);
+
+    // 1. Atama
+    const char *strategy_name = "sabit";
+    size_t removed_copies = 0;
+    if (strategy == REGALLOC_GRAPH_COLORING) {
+        strategy_name = "çizge boyama";
+        removed_copies = graph_coloring(buffer, vreg_count, remat, assignment, alias);
+    } else {
+        size_t interval_count = 0;
+        LiveInterval *intervals = sorted_intervals(buffer, vreg_count, remat, &interval_count);
+        if (strategy == REGALLOC_LINEAR_SCAN) {
+            strategy_name = "doğrusal tarama";
+            linear_scan(intervals, interval_count, assignment);
+        } else {
+            fixed_assignment(intervals, interval_count, remat, assignment);
+        }
+        free(intervals);
+    }
+
+    // 2. Taşınan kayıtlara yuva ata. Yeniden üretilen kayıtlar yuva almaz; birleştirilmiş
+    // kayıtlar yeniden üretilmez.
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (alias[v] != v) {
+            remat[v] = 0;
+            remat[alias[v]] = 0;
+        }
+    }
+#define IS_REMATERIALIZED(v) (assignment[v] == REGALLOC_SPILLED && remat[v])
+
+    size_t used_registers = 0, spilled_registers = 0, remat_registers = 0;
+    bool pool_used[ALLOCATABLE_COUNT] = {false};
+    for (uint32_t v = 0; v < vreg_count; v++) {
+        if (IS_REMATERIALIZED(v)) {
+            remat_registers++;
+        } else if (assignment[v] == REGALLOC_SPILLED) {
+            if (alias[v] == v) spilled_registers++;
+        } else if (assignment[v] >= 0 && !pool_used[assignment[v]]) {
+            pool_used[assignment[v]] = true;
+            used_registers++;
+        }
+    }
+
+    int32_t *spill_offset = (int32_t *)safe_malloc(vreg_count * sizeof(int32_t));
+    size_t spill_slots = 0;
+    if (spilled_registers > 0) {
+        uint32_t *slot = (uint32_t *)safe_malloc(vreg_count * sizeof(uint32_t));
+        spill_slots = assign_spill_slots(buffer, vreg_count, assignment, remat, alias, slot);
+        if (buffer->spill_base + 4 * (uint64_t)spill_slots > ((uint64_t)1 << 32)) {
+            report_error(ERR_CODEGEN_SPILL_OVERFLOW, 0, "Taşma alanı, programın eriştiği en yüksek adresten sonra başlar.");
+            free(slot);
+            return false;
+        }
+        for (uint32_t v = 0; v < vreg_count; v++) {
+            if (assignment[v] == REGALLOC_SPILLED && !remat[v]) spill_offset[v] = 4 * (int32_t)slot[v] - SPILL_BASE_BIAS;
+        }
+        free(slot);
+    }
+
+    // 3. Talimatları yeniden yaz: Taşınan kaynaklardan önce LW, taşınan hedeften sonra SW.
+    // Yeniden üretilen kayıtların tanımları silinir, kullanımlarından önce sabit yeniden yüklenir.
+    // Kaynağı ve hedefi aynı kayda (veya aynı yuvaya) düşen kopyalar silinir. Yuva kullanılıyorsa
+    // taban kaydı programın ilk talimatlarında kurulur.
+    size_t extra = 0;
+    for (size_t i = 0; i < buffer->count; i++) {
+        const Instruction *inst = &buffer->instructions[i];
+        Register regs[3] = {inst->rs1, inst->rs2, inst->rd};
+        for (int r = 0; r < 3; r++) {
+            if (!REGISTER_IS_VIRTUAL(regs[r])) continue;
+            uint32_t v = regs[r] - R_VIRTUAL_BASE;
+            if (assignment[v] == REGALLOC_SPILLED) extra += remat[v] ? 2 : 3;
+        }
+    }
+    extra += 2; // Taban kaydını kuran giriş talimatları
+
+    Instruction *out = (Instruction *)safe_malloc((buffer->count + extra + 1) * sizeof(Instruction));
+    size_t n = 0, spill_loads = 0, spill_stores = 0, coalesced_copies = 0;
+    if (spill_slots > 0) {
+        n += isel_constant_sequence((int32_t)(uint32_t)(buffer->spill_base + SPILL_BASE_BIAS), SPILL_BASE_REG, &out[n]);
+    }
+    for (size_t i = 0; i < buffer->count; i++) {
+        Instruction inst = buffer->instructions[i];
+
+        Register def = cfg_instruction_def(&inst);
+        if (REGISTER_IS_VIRTUAL(def) && IS_REMATERIALIZED(def - R_VIRTUAL_BASE)) {
+            continue;
+        }
+
+        if (is_register_copy(&inst) && REGISTER_IS_VIRTUAL(inst.rd) && REGISTER_IS_VIRTUAL(inst.rs1)) {
+            uint32_t d = inst.rd - R_VIRTUAL_BASE, s = inst.rs1 - R_VIRTUAL_BASE;
+            if (alias[d] == alias[s] || (assignment[d] >= 0 && assignment[d] == assignment[s])) {
+                coalesced_copies++;
+                continue;
+            }
+        }
+
+        if (REGISTER_IS_VIRTUAL(inst.rs1)) {
+            uint32_t v = inst.rs1 - R_VIRTUAL_BASE;
+            if (IS_REMATERIALIZED(v)) {
+                n += isel_constant_sequence(constant[v], SPILL_SCRATCH_REG_1, &out[n]);
+                if (inst.rs2 == inst.rs1) inst.rs2 = SPILL_SCRATCH_REG_1;
+                inst.rs1 = SPILL_SCRATCH_REG_1;
+            } else if (assignment[v] == REGALLOC_SPILLED) {
+                n += emit_spill_access(I_LW, SPILL_SCRATCH_REG_1, SPILL_SCRATCH_REG_1, spill_offset[v], &out[n]);
+                spill_loads++;
+                if (inst.rs2 == inst.rs1) inst.rs2 = SPILL_SCRATCH_REG_1;
+                inst.rs1 = SPILL_SCRATCH_REG_1;
+            } else {
+                inst.rs1 = allocatable_registers[assignment[v]];
+            }
+        }
+        if (REGISTER_IS_VIRTUAL(inst.rs2)) {
+            uint32_t v = inst.rs2 - R_VIRTUAL_BASE;
+            if (IS_REMATERIALIZED(v)) {
+                n += isel_constant_sequence(constant[v], SPILL_SCRATCH_REG_2, &out[n]);
+                inst.rs2 = SPILL_SCRATCH_REG_2;
+            } else if (assignment[v] == REGALLOC_SPILLED) {
+                n += emit_spill_access(I_LW, SPILL_SCRATCH_REG_2, SPILL_SCRATCH_REG_2, spill_offset[v], &out[n]);
+                spill_loads++;
+                inst.rs2 = SPILL_SCRATCH_REG_2;
+            } else {
+                inst.rs2 = allocatable_registers[assignment[v]];
+            }
+        }
+
+        bool store_after = false;
+        int32_t store_offset = 0;
+        if (REGISTER_IS_VIRTUAL(inst.rd)) {
+            uint32_t v = inst.rd - R_VIRTUAL_BASE;
+            if (assignment[v] == REGALLOC_SPILLED) {
+                store_after = true;
+                store_offset = spill_offset[v];
+                inst.rd = SPILL_SCRATCH_REG_1;
+            } else {
+                inst.rd = allocatable_registers[assignment[v]];
+            }
+        }
+
+        out[n++] = inst;
+        if (store_after) {
+            n += emit_spill_access(I_SW, SPILL_SCRATCH_REG_1, SPILL_SCRATCH_REG_2, store_offset, &out[n]);
+            spill_stores++;
+        }
+    }
+
+    buffer->capacity = buffer->count + extra + 1;
+    free(buffer->instructions);
+    buffer->instructions = out;
+    buffer->count = n;
+
+#undef IS_REMATERIALIZED
+    free(spill_offset);
+    free(remat);
+    free(constant);
+    free(alias);
+    free(assignment);
+
+    printf("Kayıt Ataması (%s): %zu fiziksel kayıt kullanıldı, %zu kayıt belleğe taşındı (%zu yuva, %zu yükleme, %zu depolama), "
+           "%zu sabit kayıt yeniden üretildi, %zu kopya kaldırıldı.\n",
+           strategy_name, used_registers, spilled_registers, spill_slots, spill_loads, spill_stores, remat_registers,
+           removed_copies + coalesced_copies);
+    return true;
+}
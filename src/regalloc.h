@@ -0,0 +1,37 @@
+#ifndef BESSAMBLY_REGALLOC_H
+#define BESSAMBLY_REGALLOC_H
+
+#include <stdbool.h>
+#include "ir_generator.h" // CodeBuffer ve Register için
+
+// Kayıt ataması stratejileri
+typedef enum {
+    // Sanal kayıtlar ilk görüldükleri sırayla havuzdaki boş kayıtlara atanır; canlılık aralığı
+    // biten kaydın fiziksel kaydı yeniden kullanılır. Boş kayıt yoksa belleğe taşınır (-O0/-O1/-O2).
+    REGALLOC_FIXED,
+    // Canlılık aralıkları üzerinde doğrusal tarama (linear scan). Baskı arttığında
+    // döngü derinliğine göre ağırlığı en düşük aralık taşınır (OptimizationFlags.register_alloc).
+    REGALLOC_LINEAR_SCAN,
+    // Girişim çizgesi üzerinde Chaitin/Briggs boyama ve kopya birleştirme (coalescing).
+    // En yavaş ama en kaliteli atama; taşıma adayları döngü ağırlıklı maliyetle seçilir
+    // (OptimizationFlags.graph_coloring: -O3, -Oflash).
+    REGALLOC_GRAPH_COLORING
+} RegAllocStrategy;
+
+/**
+ * @brief Sanal kayıtları (Bessambly kayıtları) fiziksel RV32I kayıtlarına atar.
+ * Optimizasyondan sonra, yerleşimden (layout_code) önce çalışır; talimat arabelleği
+ * hâlâ I_A_LABEL sanal komutlarını içerir.
+ *
+ * Ayrılmış kayıtlar: x0, sp, gp, tp, t0/t1 (ifade geçicileri), t2 (yerleşim geçişinin
+ * uzak atlama kaydı) ve t5/t6 (taşma yükleme/depolama kayıtları). Geri kalan 23 kayıt
+ * atanabilir. Taşınan kayıtlar, programın eriştiği en yüksek MEM adresinden sonra başlayan
+ * taşma alanındaki yuvalarda tutulur; sp programın başında bu alana ayarlanır
+ * (bkz. CodeBuffer.spill_base).
+ * @param buffer: Talimat arabelleği (yerinde güncellenir).
+ * @param strategy: Kullanılacak atama stratejisi.
+ * @return true: Atama başarılıysa.
+ */
+bool allocate_registers(CodeBuffer *buffer, RegAllocStrategy strategy);
+
+#endif // BESSAMBLY_REGALLOC_H
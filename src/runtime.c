@@ -0,0 +1,105 @@
+#include "runtime.h"
+
+// Rutinlerin etiketleri (first_label'a göre sıra numarası)
+enum {
+    LABEL_MUL,
+    LABEL_MUL_LOOP,
+    LABEL_MUL_SKIP,
+    LABEL_MUL_DONE,
+    LABEL_DIV,
+    LABEL_DIV_A_POSITIVE,
+    LABEL_DIV_B_POSITIVE,
+    LABEL_DIV_LOOP,
+    LABEL_DIV_SKIP,
+    LABEL_DIV_DONE,
+    LABEL_DIV_BY_ZERO
+};
+
+// Bölme rutininin sayacında sonucun işaretini tutan bit (alt bayt döngü sayacıdır)
+#define DIV_SIGN_BIT 0x100
+
+// Talimat kısaltmaları: Rutinler yalnızca fiziksel kayıtlarla yazılır
+#define EMIT(type, rd, rs1, rs2, imm) \
+    code_buffer_append(buffer, (Instruction){(type), (rd), (rs1), (rs2), (imm), SYMBOL_ID_NONE})
+#define EMIT_JUMP(type, rs1, rs2, target) \
+    code_buffer_append(buffer, (Instruction){(type), R_ZERO, (rs1), (rs2), 0, first_label + (target)})
+#define EMIT_LABEL(target) \
+    code_buffer_append(buffer, (Instruction){I_A_LABEL, R_ZERO, R_ZERO, R_ZERO, 0, first_label + (target)})
+
+/**
+ * @brief T0 = T0 * T1. Çarpanın her 1 biti için kaydırılmış çarpılan toplanır; çarpan
+ * mantıksal olarak sağa kaydırıldığından döngü en fazla 32 tur döner (küçük çarpanlarda daha az).
+ * İkiye tümleyen aritmetiğinde alt 32 bit işaretli çarpımla aynıdır.
+ */
+static void emit_multiply(SymbolId first_label, CodeBuffer *buffer) {
+    EMIT_LABEL(LABEL_MUL);
+    EMIT(I_ADDI, R_T5, R_ZERO, R_ZERO, 0);              // t5 = 0 (toplam)
+    EMIT_LABEL(LABEL_MUL_LOOP);
+    EMIT_JUMP(I_BEQ, R_T1, R_ZERO, LABEL_MUL_DONE);
+    EMIT(I_ANDI, R_T6, R_T1, R_ZERO, 1);
+    EMIT_JUMP(I_BEQ, R_T6, R_ZERO, LABEL_MUL_SKIP);
+    EMIT(I_ADD, R_T5, R_T5, R_T0, 0);
+    EMIT_LABEL(LABEL_MUL_SKIP);
+    EMIT(I_SLLI, R_T0, R_T0, R_ZERO, 1);
+    EMIT(I_SRLI, R_T1, R_T1, R_ZERO, 1);
+    EMIT_JUMP(I_JAL, R_ZERO, R_ZERO, LABEL_MUL_LOOP);
+    EMIT_LABEL(LABEL_MUL_DONE);
+    EMIT(I_ADD, R_T0, R_T5, R_ZERO, 0);
+    EMIT(I_JALR, R_ZERO, R_T2, R_ZERO, 0);
+}
+
+/**
+ * @brief T0 = T0 / T1 (işaretli, sıfıra doğru yuvarlanır). Mutlak değerler 32 turluk
+ * geri yüklemeli bölmeyle bölünür: Bölünenin üst biti kalana kaydırılır, kalan bölene
+ * yetiyorsa çıkarılır ve bölümün biti bölünenin boşalan alt bitine yazılır.
+ * t6'nın alt baytı tur sayacı, DIV_SIGN_BIT biti sonucun işaretidir (iki negatif işaret
+ * toplanınca bit temizlenir). RV32M DIV ile aynı sonuçları verir: x / 0 = -1, INT_MIN / -1 = INT_MIN.
+ */
+static void emit_divide(SymbolId first_label, CodeBuffer *buffer) {
+    EMIT_LABEL(LABEL_DIV);
+    EMIT_JUMP(I_BEQ, R_T1, R_ZERO, LABEL_DIV_BY_ZERO);
+    EMIT(I_ADDI, R_T6, R_ZERO, R_ZERO, 32);             // t6 = 32 tur
+    EMIT_JUMP(I_BGE, R_T0, R_ZERO, LABEL_DIV_A_POSITIVE);
+    EMIT(I_SUB, R_T0, R_ZERO, R_T0, 0);
+    EMIT(I_ADDI, R_T6, R_T6, R_ZERO, DIV_SIGN_BIT);
+    EMIT_LABEL(LABEL_DIV_A_POSITIVE);
+    EMIT_JUMP(I_BGE, R_T1, R_ZERO, LABEL_DIV_B_POSITIVE);
+    EMIT(I_SUB, R_T1, R_ZERO, R_T1, 0);
+    EMIT(I_ADDI, R_T6, R_T6, R_ZERO, DIV_SIGN_BIT);
+    EMIT_LABEL(LABEL_DIV_B_POSITIVE);
+    EMIT(I_ADDI, R_T5, R_ZERO, R_ZERO, 0);              // t5 = 0 (kalan)
+    EMIT_LABEL(LABEL_DIV_LOOP);
+    EMIT(I_SLLI, R_T5, R_T5, R_ZERO, 1);                // kalan = (kalan << 1) | (bölünen >> 31)
+    EMIT(I_SRLI, R_TP, R_T0, R_ZERO, 31);
+    EMIT(I_OR, R_T5, R_T5, R_TP, 0);
+    EMIT(I_SLLI, R_T0, R_T0, R_ZERO, 1);
+    EMIT_JUMP(I_BLTU, R_T5, R_T1, LABEL_DIV_SKIP);      // |INT_MIN| için işaretsiz karşılaştırma
+    EMIT(I_SUB, R_T5, R_T5, R_T1, 0);
+    EMIT(I_ORI, R_T0, R_T0, R_ZERO, 1);
+    EMIT_LABEL(LABEL_DIV_SKIP);
+    EMIT(I_ADDI, R_T6, R_T6, R_ZERO, -1);
+    EMIT(I_ANDI, R_TP, R_T6, R_ZERO, 0xFF);
+    EMIT_JUMP(I_BNE, R_TP, R_ZERO, LABEL_DIV_LOOP);
+    EMIT(I_ANDI, R_TP, R_T6, R_ZERO, DIV_SIGN_BIT);
+    EMIT_JUMP(I_BEQ, R_TP, R_ZERO, LABEL_DIV_DONE);
+    EMIT(I_SUB, R_T0, R_ZERO, R_T0, 0);
+    EMIT_LABEL(LABEL_DIV_DONE);
+    EMIT(I_JALR, R_ZERO, R_T2, R_ZERO, 0);
+    EMIT_LABEL(LABEL_DIV_BY_ZERO);
+    EMIT(I_ADDI, R_T0, R_ZERO, R_ZERO, -1);
+    EMIT(I_JALR, R_ZERO, R_T2, R_ZERO, 0);
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+SymbolId runtime_entry_label(RuntimeRoutine routine, SymbolId first_label) {
+    return first_label + (routine == RUNTIME_MUL ? LABEL_MUL : LABEL_DIV);
+}
+
+void runtime_emit(RuntimeRoutine routine, SymbolId first_label, CodeBuffer *buffer) {
+    switch (routine) {
+        case RUNTIME_MUL: emit_multiply(first_label, buffer); break;
+        case RUNTIME_DIV: emit_divide(first_label, buffer); break;
+        default: break;
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef BESSAMBLY_RUNTIME_H
+#define BESSAMBLY_RUNTIME_H
+
+#include "ir_generator.h" // CodeBuffer ve Instruction yapıları için
+
+/**
+ * @brief Yazılım Yardımcı Rutinleri (M eklentisi olmayan hedefler için)
+ * Çarpma ve bölme, programın sonuna (HALT'tan sonra) eklenen küçük rutinlere I_A_CALL ile
+ * yapılan çağrılarla gerçekleştirilir. Çağrı kuralı:
+ *   - Argümanlar T0 ve T1'de, sonuç T0'da döner.
+ *   - Dönüş adresi T2'dedir; rutin JALR x0, 0(t2) ile döner.
+ *   - Rutinler yalnızca ayrılmış kayıtları (T0, T1, T5, T6, tp) bozar; atanabilir kayıtlar
+ *     ve taşma yuvaları korunur, bu yüzden çağrı kayıt ataması için sıradan bir talimattır.
+ */
+
+typedef enum {
+    RUNTIME_MUL, // T0 = T0 * T1 (kaydır-topla)
+    RUNTIME_DIV, // T0 = T0 / T1 (işaretli, sıfıra doğru; geri yüklemeli bölme)
+    RUNTIME_ROUTINE_COUNT
+} RuntimeRoutine;
+
+// Rutinlerin kullandığı etiket kimliği sayısı (giriş ve iç etiketler).
+// Kimlikler program isimlerinden sonra ayrılır (bkz. isel_init).
+#define RUNTIME_LABEL_COUNT 11
+
+/**
+ * @brief Rutinin giriş etiketini döndürür.
+ * @param first_label: Rutinlere ayrılmış ilk etiket kimliği.
+ */
+SymbolId runtime_entry_label(RuntimeRoutine routine, SymbolId first_label);
+
+/**
+ * @brief Rutinin talimatlarını arabelleğin sonuna ekler.
+ */
+void runtime_emit(RuntimeRoutine routine, SymbolId first_label, CodeBuffer *buffer);
+
+#endif // BESSAMBLY_RUNTIME_H
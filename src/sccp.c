@@ -0,0 +1,544 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sccp.h"
+#include "cfg.h"   // Talimat özellikleri için
+#include "utils.h" // safe_malloc için
+
+// Kafes: Belirsiz (henüz değer görülmedi) -> Sabit -> Değişken
+typedef enum {
+    LATTICE_TOP,
+    LATTICE_CONST,
+    LATTICE_BOTTOM
+} LatticeState;
+
+typedef struct {
+    uint8_t state;
+    int32_t value; // Yalnızca LATTICE_CONST için
+} Lattice;
+
+static const Lattice lattice_top = {LATTICE_TOP, 0};
+static const Lattice lattice_bottom = {LATTICE_BOTTOM, 0};
+
+typedef struct {
+    MirFunction *mir;
+    Lattice *values;            // SSA değeri -> kafes
+    Lattice registers[R_COUNT]; // Fiziksel kayıtlar (yalnızca blok içinde izlenir)
+    bool *executable;           // Blok çalışabilir mi
+    bool (*edges)[2];           // edges[b][s]: b'nin s. ardıl kenarı çalışabilir mi
+    bool *roots;                // Girişi bilinmeyen kök bloklar (yardımcı rutinler)
+    uint32_t *worklist;
+    uint32_t worklist_count;
+    bool *queued;
+} SccpState;
+
+typedef struct {
+    size_t constants;   // Sabit olduğu kanıtlanan SSA değerleri
+    size_t folded;      // Tek bir ADDI/LUI'ye çevrilen talimatlar
+    size_t operands;    // x0'a veya sabitli biçime çevrilen operantlar
+    size_t branches;    // Koşulu bilinen dallanmalar
+    size_t unreachable; // Erişilemeyen bloklarla silinen talimatlar
+} SccpStats;
+
+static Lattice lattice_const(int32_t value) {
+    return (Lattice){LATTICE_CONST, value};
+}
+
+static Lattice lattice_meet(Lattice a, Lattice b) {
+    if (a.state == LATTICE_TOP) return b;
+    if (b.state == LATTICE_TOP) return a;
+    if (a.state == LATTICE_CONST && b.state == LATTICE_CONST && a.value == b.value) return a;
+    return lattice_bottom;
+}
+
+static bool fits_imm12(int64_t value) {
+    return value >= -2048 && value <= 2047;
+}
+
+// --- Sabit Değerlendirme ---
+
+/**
+ * @brief Katlanabilen talimatın okuduğu kayıt operantı sayısını döndürür.
+ * @return int: 2 (R biçimi ve dallanmalar), 1 (sabitli işlemler), 0 (LUI), -1 (katlanamaz).
+ */
+static int operand_count(InstructionType type) {
+    switch (type) {
+        case I_ADD: case I_SUB: case I_AND: case I_OR: case I_XOR:
+        case I_SLL: case I_SRL: case I_SRA: case I_SLT: case I_SLTU:
+        case I_MUL: case I_MULH: case I_MULHSU: case I_MULHU:
+        case I_DIV: case I_DIVU: case I_REM: case I_REMU:
+        case I_BEQ: case I_BNE: case I_BLT: case I_BGE: case I_BLTU: case I_BGEU:
+            return 2;
+        case I_ADDI: case I_ANDI: case I_ORI: case I_XORI: case I_SLTI: case I_SLTIU:
+        case I_SLLI: case I_SRLI: case I_SRAI:
+            return 1;
+        case I_LUI:
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+/**
+ * @brief İşlemi RV32IM anlamıyla hesaplar (b: ikinci kayıt veya sabit).
+ * Sıfıra bölme ve INT32_MIN / -1 taşması donanımın verdiği sonucu verir.
+ */
+static int32_t fold_operation(InstructionType type, int32_t a, int32_t b) {
+    uint32_t ua = (uint32_t)a, ub = (uint32_t)b;
+    switch (type) {
+        case I_ADD: case I_ADDI: return (int32_t)(ua + ub);
+        case I_SUB:              return (int32_t)(ua - ub);
+        case I_AND: case I_ANDI: return a & b;
+        case I_OR:  case I_ORI:  return a | b;
+        case I_XOR: case I_XORI: return a ^ b;
+        case I_SLL: case I_SLLI: return (int32_t)(ua << (ub & 31));
+        case I_SRL: case I_SRLI: return (int32_t)(ua >> (ub & 31));
+        case I_SRA: case I_SRAI: return a >> (ub & 31);
+        case I_SLT: case I_SLTI:   return a < b;
+        case I_SLTU: case I_SLTIU: return ua < ub;
+        case I_MUL:    return (int32_t)(ua * ub);
+        case I_MULH:   return (int32_t)(((int64_t)a * (int64_t)b) >> 32);
+        case I_MULHSU: return (int32_t)(((int64_t)a * (int64_t)ub) >> 32);
+        case I_MULHU:  return (int32_t)(((uint64_t)ua * (uint64_t)ub) >> 32);
+        case I_DIV:
+            if (b == 0) return -1;
+            if (a == INT32_MIN && b == -1) return INT32_MIN;
+            return a / b;
+        case I_DIVU: return b == 0 ? -1 : (int32_t)(ua / ub);
+        case I_REM:
+            if (b == 0) return a;
+            if (a == INT32_MIN && b == -1) return 0;
+            return a % b;
+        case I_REMU: return b == 0 ? a : (int32_t)(ua % ub);
+        case I_LUI:  return (int32_t)(ub << 12);
+        default:     return 0;
+    }
+}
+
+static bool branch_taken(InstructionType type, int32_t a, int32_t b) {
+    switch (type) {
+        case I_BEQ:  return a == b;
+        case I_BNE:  return a != b;
+        case I_BLT:  return a < b;
+        case I_BGE:  return a >= b;
+        case I_BLTU: return (uint32_t)a < (uint32_t)b;
+        default:     return (uint32_t)a >= (uint32_t)b; // I_BGEU
+    }
+}
+
+static Lattice operand_lattice(const SccpState *state, const MirInst *mi, int slot) {
+    if (mi->uses[slot] != MIR_NO_VALUE) return state->values[mi->uses[slot]];
+    Register reg = slot == 0 ? mi->inst.rs1 : mi->inst.rs2;
+    if (reg == R_ZERO) return lattice_const(0);
+    if ((uint32_t)reg < R_COUNT) return state->registers[reg];
+    return lattice_bottom;
+}
+
+/**
+ * @brief Talimatın operantlarını birleştirir: Biri değişkense değişken, biri belirsizse belirsiz.
+ */
+static Lattice evaluate_operands(const SccpState *state, const MirInst *mi, int count, int32_t operands[2]) {
+    bool unknown = false;
+    for (int slot = 0; slot < count; slot++) {
+        Lattice l = operand_lattice(state, mi, slot);
+        if (l.state == LATTICE_BOTTOM) return lattice_bottom;
+        if (l.state == LATTICE_TOP) unknown = true;
+        operands[slot] = l.value;
+    }
+    return unknown ? lattice_top : lattice_const(0);
+}
+
+static Lattice evaluate_instruction(const SccpState *state, const MirInst *mi) {
+    int count = operand_count(mi->inst.type);
+    if (count < 0 || cfg_is_branch(mi->inst.type)) return lattice_bottom;
+    int32_t operands[2] = {0, 0};
+    Lattice l = evaluate_operands(state, mi, count, operands);
+    if (l.state != LATTICE_CONST) return l;
+    int32_t second = count == 2 ? operands[1] : mi->inst.immediate;
+    return lattice_const(fold_operation(mi->inst.type, operands[0], second));
+}
+
+// --- Yayılım ---
+
+static void push_block(SccpState *state, uint32_t block) {
+    if (state->queued[block]) return;
+    state->queued[block] = true;
+    state->worklist[state->worklist_count++] = block;
+}
+
+static void set_value(SccpState *state, MirValueId value, Lattice l) {
+    Lattice old = state->values[value];
+    Lattice merged = lattice_meet(old, l);
+    if (merged.state == old.state && merged.value == old.value) return;
+    state->values[value] = merged;
+
+    // Değişen değerin kullanıcılarının blokları yeniden değerlendirilir
+    const MirFunction *mir = state->mir;
+    for (uint32_t u = mir_first_use(mir, value); u != MIR_NO_USE; u = mir->uses[u].next) {
+        const MirUse *use = &mir->uses[u];
+        uint32_t block = use->in_phi ? mir->phis[use->user].block : mir->insts[use->user].block;
+        if (state->executable[block]) push_block(state, block);
+    }
+}
+
+static void mark_edge(SccpState *state, uint32_t block, int s) {
+    uint32_t succ = state->mir->blocks[block].successors[s];
+    if (succ == MIR_NO_BLOCK || state->edges[block][s]) return;
+    state->edges[block][s] = true;
+    state->executable[succ] = true;
+    push_block(state, succ); // Yeni kenar, phi düğümlerinin birleşimini değiştirir
+}
+
+static bool edge_executable(const SccpState *state, uint32_t from, uint32_t to) {
+    const MirBlock *block = &state->mir->blocks[from];
+    return (state->edges[from][0] && block->successors[0] == to) ||
+           (state->edges[from][1] && block->successors[1] == to);
+}
+
+static void evaluate_terminator(SccpState *state, uint32_t b, const MirInst *mi) {
+    if (cfg_is_branch(mi->inst.type)) {
+        int32_t operands[2] = {0, 0};
+        Lattice l = evaluate_operands(state, mi, 2, operands);
+        if (l.state == LATTICE_TOP) return; // Koşul henüz bilinmiyor: İyimser olarak hiçbir kenar
+        if (l.state == LATTICE_CONST) {
+            mark_edge(state, b, branch_taken(mi->inst.type, operands[0], operands[1]) ? 1 : 0);
+        } else {
+            mark_edge(state, b, 0);
+            mark_edge(state, b, 1);
+        }
+        return;
+    }
+    if (mi->def != MIR_NO_VALUE) set_value(state, mi->def, lattice_bottom); // Dönüş adresi
+    if (mi->inst.type == I_JAL) mark_edge(state, b, 0);
+}
+
+static void process_block(SccpState *state, uint32_t b) {
+    MirFunction *mir = state->mir;
+    const MirBlock *block = &mir->blocks[b];
+
+    for (uint32_t p = 0; p < block->phi_count; p++) {
+        const MirPhi *phi = &mir->phis[block->phis[p]];
+        Lattice l = state->roots[b] ? lattice_bottom : lattice_top;
+        for (uint32_t k = 0; k < block->predecessor_count; k++) {
+            if (!edge_executable(state, block->predecessors[k], b)) continue;
+            l = lattice_meet(l, phi->args[k] == MIR_NO_VALUE ? lattice_bottom : state->values[phi->args[k]]);
+        }
+        set_value(state, phi->def, l);
+    }
+
+    for (uint32_t r = 0; r < R_COUNT; r++) state->registers[r] = lattice_bottom;
+    state->registers[R_ZERO] = lattice_const(0);
+
+    for (uint32_t i = block->first; i < block->end; i++) {
+        const MirInst *mi = &mir->insts[i];
+        if (mi->dead) continue;
+        if (i + 1 == block->end && cfg_is_terminator(mi->inst.type)) {
+            evaluate_terminator(state, b, mi);
+            return;
+        }
+        if (mi->inst.type == I_A_CALL) {
+            // Rutin geçicileri bozar: Blokta izlenen tüm fiziksel kayıtlar unutulur
+            for (uint32_t r = 1; r < R_COUNT; r++) state->registers[r] = lattice_bottom;
+            continue;
+        }
+        Lattice result = evaluate_instruction(state, mi);
+        Register def = cfg_instruction_def(&mi->inst);
+        if (mi->def != MIR_NO_VALUE) {
+            set_value(state, mi->def, result);
+        } else if (def != R_ZERO && (uint32_t)def < R_COUNT) {
+            state->registers[def] = result;
+        }
+    }
+    mark_edge(state, b, 0); // Sonlandırıcı yok: Sonraki bloğa düşülür
+}
+
+// --- Sonuçları Uygulama ---
+
+/**
+ * @brief Değerin kullanım listesinden bir kullanımı çıkarır.
+ */
+static void remove_use(MirFunction *mir, MirValueId value, uint32_t user, uint32_t slot, bool in_phi) {
+    if (value == MIR_NO_VALUE) return;
+    uint32_t *link = &mir->values[value].first_use;
+    while (*link != MIR_NO_USE) {
+        MirUse *use = &mir->uses[*link];
+        if (use->user == user && use->slot == slot && use->in_phi == in_phi) {
+            *link = use->next;
+            mir->values[value].use_count--;
+            return;
+        }
+        link = &use->next;
+    }
+}
+
+static void move_use(MirFunction *mir, MirValueId value, uint32_t user, uint32_t from, uint32_t to) {
+    if (value == MIR_NO_VALUE) return;
+    for (uint32_t u = mir_first_use(mir, value); u != MIR_NO_USE; u = mir->uses[u].next) {
+        MirUse *use = &mir->uses[u];
+        if (!use->in_phi && use->user == user && use->slot == from) {
+            use->slot = to;
+            return;
+        }
+    }
+}
+
+static void drop_operands(MirFunction *mir, uint32_t index) {
+    MirInst *mi = &mir->insts[index];
+    for (uint32_t slot = 0; slot < 2; slot++) {
+        remove_use(mir, mi->uses[slot], index, slot, false);
+        mi->uses[slot] = MIR_NO_VALUE;
+    }
+    mi->inst.rs1 = R_ZERO;
+    mi->inst.rs2 = R_ZERO;
+}
+
+static void kill_block(MirFunction *mir, uint32_t b, SccpStats *stats) {
+    MirBlock *block = &mir->blocks[b];
+    for (uint32_t i = block->first; i < block->end; i++) {
+        if (mir->insts[i].dead) continue;
+        drop_operands(mir, i);
+        mir->insts[i].dead = true;
+        stats->unreachable++;
+    }
+    for (uint32_t p = 0; p < block->phi_count; p++) {
+        MirPhi *phi = &mir->phis[block->phis[p]];
+        for (uint32_t k = 0; k < block->predecessor_count; k++) {
+            remove_use(mir, phi->args[k], block->phis[p], k, true);
+        }
+        phi->dead = true;
+    }
+    block->successors[0] = block->successors[1] = MIR_NO_BLOCK;
+}
+
+// Kayıt-kayıt işleminin sabitli karşılığı (yoksa I_A_LABEL)
+static InstructionType immediate_form(InstructionType type) {
+    switch (type) {
+        case I_ADD:  return I_ADDI;
+        case I_SUB:  return I_ADDI; // Sabit eksi işaretle
+        case I_AND:  return I_ANDI;
+        case I_OR:   return I_ORI;
+        case I_XOR:  return I_XORI;
+        case I_SLL:  return I_SLLI;
+        case I_SRL:  return I_SRLI;
+        case I_SRA:  return I_SRAI;
+        case I_SLT:  return I_SLTI;
+        case I_SLTU: return I_SLTIU;
+        default:     return I_A_LABEL;
+    }
+}
+
+static bool is_commutative(InstructionType type) {
+    return type == I_ADD || type == I_AND || type == I_OR || type == I_XOR;
+}
+
+static bool is_memory_access(InstructionType type) {
+    switch (type) {
+        case I_LW: case I_LH: case I_LHU: case I_LB: case I_LBU:
+        case I_SW: case I_SH: case I_SB:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Değeri sabit olan talimatı tek bir ADDI veya LUI'ye çevirir.
+ * @return true eğer talimat değiştirildiyse.
+ */
+static bool fold_to_constant(MirFunction *mir, uint32_t index, int32_t c) {
+    MirInst *mi = &mir->insts[index];
+    Instruction *inst = &mi->inst;
+    if (fits_imm12(c)) {
+        if (inst->type == I_ADDI && inst->rs1 == R_ZERO && inst->immediate == c) return false;
+        drop_operands(mir, index);
+        inst->type = I_ADDI;
+        inst->immediate = c;
+        return true;
+    }
+    if ((c & 0xFFF) == 0) {
+        int32_t upper = (int32_t)((uint32_t)c >> 12);
+        if (inst->type == I_LUI && inst->immediate == upper) return false;
+        drop_operands(mir, index);
+        inst->type = I_LUI;
+        inst->immediate = upper;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Sabit operantları talimata katar: Kayıt-kayıt işlemi sabitli biçime, bellek erişiminin
+ * sabit tabanı ofsete, sıfır değerli operantlar x0'a çevrilir.
+ * @return size_t: Değiştirilen operant sayısı.
+ */
+static size_t fold_operands(const SccpState *state, uint32_t index) {
+    MirFunction *mir = state->mir;
+    MirInst *mi = &mir->insts[index];
+    Instruction *inst = &mi->inst;
+    size_t changed = 0;
+
+    bool known[2];
+    int32_t value[2];
+    for (int slot = 0; slot < 2; slot++) {
+        MirValueId v = mi->uses[slot];
+        known[slot] = v != MIR_NO_VALUE && state->values[v].state == LATTICE_CONST;
+        value[slot] = known[slot] ? state->values[v].value : 0;
+    }
+
+    InstructionType immediate_type = immediate_form(inst->type);
+    if (immediate_type != I_A_LABEL && known[0] != known[1]) {
+        uint32_t k = known[0] ? 0 : 1; // Sabit operant
+        int64_t imm = inst->type == I_SUB ? -(int64_t)value[k] : value[k];
+        if (immediate_type == I_SLLI || immediate_type == I_SRLI || immediate_type == I_SRAI) imm &= 31;
+        if ((k == 1 || is_commutative(inst->type)) && value[k] != 0 && fits_imm12(imm)) {
+            remove_use(mir, mi->uses[k], index, k, false);
+            if (k == 0) {
+                // Değişken operant rs1'e alınır
+                move_use(mir, mi->uses[1], index, 1, 0);
+                mi->uses[0] = mi->uses[1];
+                inst->rs1 = inst->rs2;
+            }
+            mi->uses[1] = MIR_NO_VALUE;
+            inst->rs2 = R_ZERO;
+            inst->type = immediate_type;
+            inst->immediate = (int32_t)imm;
+            return 1;
+        }
+    }
+
+    if (is_memory_access(inst->type) && known[0] && fits_imm12((int64_t)inst->immediate + value[0])) {
+        remove_use(mir, mi->uses[0], index, 0, false);
+        mi->uses[0] = MIR_NO_VALUE;
+        inst->rs1 = R_ZERO;
+        inst->immediate += value[0];
+        known[0] = false;
+        changed++;
+    }
+
+    for (uint32_t slot = 0; slot < 2; slot++) {
+        if (!known[slot] || value[slot] != 0) continue;
+        remove_use(mir, mi->uses[slot], index, slot, false);
+        mi->uses[slot] = MIR_NO_VALUE;
+        if (slot == 0) inst->rs1 = R_ZERO;
+        else inst->rs2 = R_ZERO;
+        changed++;
+    }
+    return changed;
+}
+
+static size_t apply_results(SccpState *state, SccpStats *stats) {
+    MirFunction *mir = state->mir;
+
+    for (uint32_t v = 1; v < mir->value_count; v++) {
+        if (state->values[v].state == LATTICE_CONST) stats->constants++;
+    }
+
+    for (uint32_t b = 0; b < mir->block_count; b++) {
+        MirBlock *block = &mir->blocks[b];
+        if (!state->executable[b]) {
+            kill_block(mir, b, stats);
+            continue;
+        }
+
+        for (uint32_t i = block->first; i < block->end; i++) {
+            MirInst *mi = &mir->insts[i];
+            if (mi->dead) continue;
+
+            if (i + 1 == block->end && cfg_is_branch(mi->inst.type)) {
+                bool fallthrough = state->edges[b][0], taken = state->edges[b][1];
+                if (block->successors[0] == block->successors[1] || fallthrough == taken) {
+                    stats->operands += fold_operands(state, i);
+                    continue;
+                }
+                if (taken) {
+                    // Her zaman alınır: Koşulsuz atlama
+                    drop_operands(mir, i);
+                    mi->inst.type = I_JAL;
+                    mi->inst.rd = R_ZERO;
+                    mi->inst.immediate = 0;
+                    block->successors[0] = block->successors[1];
+                } else {
+                    // Hiç alınmaz: Dallanma silinir, sonraki bloğa düşülür
+                    drop_operands(mir, i);
+                    mi->dead = true;
+                }
+                block->successors[1] = MIR_NO_BLOCK;
+                stats->branches++;
+                continue;
+            }
+
+            if (mi->def != MIR_NO_VALUE && operand_count(mi->inst.type) >= 0 &&
+                state->values[mi->def].state == LATTICE_CONST &&
+                fold_to_constant(mir, i, state->values[mi->def].value)) {
+                stats->folded++;
+                continue;
+            }
+            if (mi->inst.type != I_A_CALL) stats->operands += fold_operands(state, i);
+        }
+    }
+    return stats->folded + stats->operands + stats->branches + stats->unreachable;
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+size_t sccp_optimize(MirFunction *mir) {
+    uint32_t block_count = mir->block_count;
+    SccpState state;
+    state.mir = mir;
+    state.values = (Lattice *)safe_malloc((mir->value_count + 1) * sizeof(Lattice));
+    state.executable = (bool *)safe_malloc((block_count + 1) * sizeof(bool));
+    state.edges = (bool (*)[2])safe_malloc((block_count + 1) * sizeof(bool[2]));
+    state.roots = (bool *)safe_malloc((block_count + 1) * sizeof(bool));
+    state.queued = (bool *)safe_malloc((block_count + 1) * sizeof(bool));
+    state.worklist = (uint32_t *)safe_malloc((block_count + 1) * sizeof(uint32_t));
+    state.worklist_count = 0;
+    memset(state.executable, 0, (block_count + 1) * sizeof(bool));
+    memset(state.edges, 0, (block_count + 1) * sizeof(bool[2]));
+    memset(state.roots, 0, (block_count + 1) * sizeof(bool));
+    memset(state.queued, 0, (block_count + 1) * sizeof(bool));
+
+    // Program girişinde okunan değerler bilinmez; diğerleri iyimser olarak belirsiz başlar
+    for (uint32_t v = 0; v < mir->value_count; v++) {
+        state.values[v] = mir->values[v].kind == MIR_DEF_ENTRY ? lattice_bottom : lattice_top;
+    }
+
+    // Kökler: Giriş bloğu ve I_A_CALL ile çağrılan yardımcı rutinlerin blokları
+    state.roots[0] = state.executable[0] = true;
+    push_block(&state, 0);
+    SymbolId max_label = SYMBOL_ID_NONE;
+    for (uint32_t i = 0; i < mir->inst_count; i++) {
+        if (mir->insts[i].inst.label > max_label) max_label = mir->insts[i].inst.label;
+    }
+    uint32_t *label_block = (uint32_t *)safe_malloc(((size_t)max_label + 1) * sizeof(uint32_t));
+    for (SymbolId id = 0; id <= max_label; id++) label_block[id] = UINT32_MAX;
+    for (uint32_t i = 0; i < mir->inst_count; i++) {
+        if (mir->insts[i].inst.type == I_A_LABEL) label_block[mir->insts[i].inst.label] = mir->insts[i].block;
+    }
+    for (uint32_t i = 0; i < mir->inst_count; i++) {
+        if (mir->insts[i].inst.type != I_A_CALL) continue;
+        uint32_t target = label_block[mir->insts[i].inst.label];
+        if (target == UINT32_MAX || state.roots[target]) continue;
+        state.roots[target] = state.executable[target] = true;
+        push_block(&state, target);
+    }
+    free(label_block);
+
+    while (state.worklist_count > 0) {
+        uint32_t b = state.worklist[--state.worklist_count];
+        state.queued[b] = false;
+        process_block(&state, b);
+    }
+
+    SccpStats stats = {0};
+    size_t changes = apply_results(&state, &stats);
+    printf("SCCP: %zu sabit değer, %zu talimat sabite katlandı, %zu operant sabitlendi, %zu dallanma çözüldü, %zu erişilemez talimat silindi.\n",
+           stats.constants, stats.folded, stats.operands, stats.branches, stats.unreachable);
+
+    free(state.worklist);
+    free(state.queued);
+    free(state.roots);
+    free(state.edges);
+    free(state.executable);
+    free(state.values);
+    return changes;
+}
@@ -0,0 +1,24 @@
+#ifndef BESSAMBLY_SCCP_H
+#define BESSAMBLY_SCCP_H
+
+#include <stddef.h>
+#include "mir.h" // SSA biçimindeki orta seviye IR
+
+/**
+ * @brief Seyrek Koşullu Sabit Yayılımı (Sparse Conditional Constant Propagation)
+ * MIR üzerinde çalışır. Her SSA değeri için kafes (belirsiz -> sabit -> değişken) tutulur ve
+ * yalnızca çalışabilir kenarlardan gelen değerler birleştirilir: Koşulu sabit olan bir dallanmanın
+ * alınmayan kenarı hiç çalışabilir olmaz, bu yüzden o yoldaki atamalar phi düğümlerini bozmaz.
+ * Değeri değişen bir SSA değerinin kullanıcılarının blokları def-use zincirleriyle yeniden
+ * değerlendirilir. Fiziksel ifade geçicileri (T0/T1) blok içinde izlenir.
+ *
+ * Sonuçlar uygulanırken sabit değerli talimatlar tek bir ADDI/LUI'ye, sabit operantlar x0'a veya
+ * talimatın sabitli biçimine (ADD -> ADDI, ...) çevrilir; koşulu bilinen dallanmalar koşulsuz atlamaya
+ * dönüşür veya silinir ve girişten erişilemeyen bloklar silinir. Yardımcı rutinler (I_A_CALL hedefleri)
+ * her zaman erişilebilir sayılır.
+ *
+ * @return size_t: Yapılan değişiklik sayısı.
+ */
+size_t sccp_optimize(MirFunction *mir);
+
+#endif // BESSAMBLY_SCCP_H
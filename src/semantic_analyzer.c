@@ -13,23 +13,22 @@
  * @return true eğer tüm etiketler benzersiz ve başarılı bir şekilde eklendiyse.
  */
 static bool pass_one_collect_labels(AST_Program *program, SymbolTable *sym_table) {
-    AST_Node *current = program->first_statement;
-    int instruction_address = 0; // Bessambly'de satır numarasını adres olarak kullanıyoruz
+    int instruction_address = 0; // Geçici adres (komut indeksi); kesin bayt adresini yerleşim geçişi atar
 
-    while (current != NULL) {
-        if (current->type == STMT_TYPE_LABEL_DEF) {
-            const char *label_name = current->data.label_def.label_name;
+    for (AST_StmtIndex i = 0; i < program->statement_count; i++) {
+        if (ast_stmt_type(program, i) == STMT_TYPE_LABEL_DEF) {
+            SymbolId label = ast_stmt_label(program, i);
 
             // 1. Etiketin Zaten Tanımlı Olup Olmadığını Kontrol Et
-            if (symtable_lookup(sym_table, label_name) != NULL) {
+            if (symtable_lookup(sym_table, label) != NULL) {
                 // Hata: Aynı etiket iki kez tanımlanmış
-                report_error(ERR_SEMANTIC_DUPLICATE_LABEL, current->line_number, 
-                             label_name);
+                report_error(ERR_SEMANTIC_DUPLICATE_LABEL, ast_stmt_line(program, i), 
+                             ast_name(program, label));
                 return false;
             }
 
-            // 2. Etiketi tabloya ekle (Adres olarak satır numarasını kullanıyoruz)
-            if (!symtable_add(sym_table, label_name, SYM_TYPE_LABEL, (long long)instruction_address)) {
+            // 2. Etiketi tabloya ekle
+            if (!symtable_add(sym_table, label, SYM_TYPE_LABEL, (long long)instruction_address)) {
                 // symtable_add zaten hata raporlar, sadece çık
                 return false; 
             }
@@ -37,7 +36,6 @@ static bool pass_one_collect_labels(AST_Program *program, SymbolTable *sym_table
         
         // Etiketler de dahil olmak üzere her komut, program akışında bir yer kaplar.
         instruction_address++;
-        current = current->next;
     }
     return true;
 }
@@ -52,30 +50,22 @@ static bool pass_one_collect_labels(AST_Program *program, SymbolTable *sym_table
  * @return true eğer tüm atlama hedefleri bulunursa.
  */
 static bool pass_two_verify_jumps(AST_Program *program, SymbolTable *sym_table) {
-    AST_Node *current = program->first_statement;
-    
-    while (current != NULL) {
-        const char *target_label = NULL;
+    for (AST_StmtIndex i = 0; i < program->statement_count; i++) {
+        StatementType type = ast_stmt_type(program, i);
 
-        if (current->type == STMT_TYPE_GOTO) {
-            target_label = current->data.goto_stmt.target_label;
-        } else if (current->type == STMT_TYPE_IF_GOTO) {
-            target_label = current->data.if_goto_stmt.target_label;
-        }
+        if (type == STMT_TYPE_GOTO || type == STMT_TYPE_IF_GOTO) {
+            SymbolId target_label = ast_stmt_label(program, i);
 
-        if (target_label != NULL) {
             // Hedef etiketi Sembol Tablosunda ara
             const Symbol *target_sym = symtable_lookup(sym_table, target_label);
 
             if (target_sym == NULL || target_sym->type != SYM_TYPE_LABEL) {
                 // Hata: Hedef etiket bulunamadı
-                report_error(ERR_SEMANTIC_UNKNOWN_LABEL, current->line_number, 
-                             target_label);
+                report_error(ERR_SEMANTIC_UNKNOWN_LABEL, ast_stmt_line(program, i), 
+                             ast_name(program, target_label));
                 return false;
             }
         }
-        
-        current = current->next;
     }
     return true;
 }
@@ -92,7 +82,7 @@ bool analyze_semantic(AST_Program *program, SymbolTable *sym_table) {
     }
 
     // DEBUG: Toplanan Etiketleri Yazdır (Opsiyonel)
-    // symtable_print(sym_table); 
+    // symtable_print(sym_table, &program->names); 
 
     // 2. Geçiş: Atlama Doğrulama
     if (!pass_two_verify_jumps(program, sym_table)) {
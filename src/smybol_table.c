@@ -5,30 +5,77 @@
 #include "error.h" // Hata raporlama için
 #include "utils.h" // safe_malloc/safe_realloc için
 
+#define SYMTABLE_INITIAL_CAPACITY 64  // İlk sembol kapasitesi
+#define SYMTABLE_INITIAL_SLOTS    128 // İlk yuva sayısı (2'nin kuvveti)
+
+// --- Yardımcı İşlevler ---
+
+/**
+ * @brief İsim kimliğinin yuva indeksini hesaplar (Fibonacci çarpımsal özetleme).
+ * Kimlikler yoğun olduğundan tek bir çarpma yeterli dağılımı sağlar.
+ */
+static uint32_t symtable_slot(const SymbolTable *table, SymbolId name) {
+    return (name * 2654435761u) & table->slot_mask;
+}
+
+/**
+ * @brief Yuva tablosunu verilen boyutta yeniden kurar (doluluk oranı 1/2'nin altında tutulur).
+ */
+static void symtable_rehash(SymbolTable *table, uint32_t slot_count) {
+    free(table->slots);
+    table->slots = (int32_t *)safe_malloc(slot_count * sizeof(int32_t));
+    memset(table->slots, 0, slot_count * sizeof(int32_t));
+    table->slot_mask = slot_count - 1;
+
+    for (int i = 0; i < table->count; i++) {
+        uint32_t slot = symtable_slot(table, table->entries[i].name);
+        while (table->slots[slot] != 0) {
+            slot = (slot + 1) & table->slot_mask; // Doğrusal yoklama
+        }
+        table->slots[slot] = i + 1;
+    }
+}
+
+/**
+ * @brief İsmin yuvasını bulur: sembolü içeren yuva veya eklenecek boş yuva.
+ */
+static uint32_t symtable_probe(const SymbolTable *table, SymbolId name) {
+    uint32_t slot = symtable_slot(table, name);
+    while (table->slots[slot] != 0 && table->entries[table->slots[slot] - 1].name != name) {
+        slot = (slot + 1) & table->slot_mask;
+    }
+    return slot;
+}
+
+// --- Genel İşlev Uygulamaları ---
+
 SymbolTable *symtable_init() {
     SymbolTable *table = (SymbolTable *)safe_malloc(sizeof(SymbolTable));
+    table->entries = (Symbol *)safe_malloc(SYMTABLE_INITIAL_CAPACITY * sizeof(Symbol));
     table->count = 0;
-    // Diziyi sıfırlamaya gerek yok, count ile kontrol ediliyor.
+    table->capacity = SYMTABLE_INITIAL_CAPACITY;
+    table->slots = NULL;
+    symtable_rehash(table, SYMTABLE_INITIAL_SLOTS);
     return table;
 }
 
-bool symtable_add(SymbolTable *table, const char *name, SymbolType type, long long address) {
-    if (table->count >= MAX_SYMBOLS) {
-        report_error(ERR_OUT_OF_MEMORY, 0, "Sembol Tablosu dolu, yeni sembol eklenemiyor.");
-        return false;
-    }
-
+bool symtable_add(SymbolTable *table, SymbolId name, SymbolType type, long long address) {
     // Sembolün zaten var olup olmadığını kontrol et (Özellikle Etiketler için önemli)
-    if (symtable_lookup(table, name) != NULL) {
+    uint32_t slot = symtable_probe(table, name);
+    if (table->slots[slot] != 0) {
         // Sembolik analiz aşamasında bu durum "DUPLICATE_LABEL" hatası olarak raporlanmalıdır.
         return false; 
     }
 
+    if (table->count >= table->capacity) {
+        table->capacity *= 2;
+        table->entries = (Symbol *)safe_realloc(table->entries, table->capacity * sizeof(Symbol));
+    }
+
     // Yeni Sembolü Ekle
     Symbol *new_sym = &table->entries[table->count];
     
-    strncpy(new_sym->name, name, MAX_LABEL_LENGTH - 1);
-    new_sym->name[MAX_LABEL_LENGTH - 1] = '\0';
+    new_sym->name = name;
     new_sym->type = type;
     
     if (type == SYM_TYPE_LABEL) {
@@ -37,36 +84,49 @@ bool symtable_add(SymbolTable *table, const char *name, SymbolType type, long lo
     // Kayıtlar için şimdilik adres/size ataması yapmıyoruz, ileride eklenebilir.
     
     table->count++;
+    table->slots[slot] = table->count;
+
+    // Doluluk oranı 1/2'yi geçerse yuva tablosunu iki katına çıkar
+    if ((uint32_t)table->count * 2 > table->slot_mask + 1) {
+        symtable_rehash(table, (table->slot_mask + 1) * 2);
+    }
     return true;
 }
 
-const Symbol *symtable_lookup(SymbolTable *table, const char *name) {
-    for (int i = 0; i < table->count; i++) {
-        if (strcmp(table->entries[i].name, name) == 0) {
-            return &table->entries[i];
-        }
+const Symbol *symtable_lookup(SymbolTable *table, SymbolId name) {
+    int32_t index = table->slots[symtable_probe(table, name)];
+    return index != 0 ? &table->entries[index - 1] : NULL; // 0: Bulunamadı
+}
+
+bool symtable_set_address(SymbolTable *table, SymbolId name, long long address) {
+    int32_t index = table->slots[symtable_probe(table, name)];
+    if (index == 0) {
+        return false;
     }
-    return NULL; // Bulunamadı
+    table->entries[index - 1].details.address = address;
+    return true;
 }
 
 void symtable_free(SymbolTable *table) {
     if (table != NULL) {
+        free(table->entries);
+        free(table->slots);
         free(table);
     }
 }
 
 // --- DEBUG Fonksiyonu (Opsiyonel) ---
-void symtable_print(SymbolTable *table) {
+void symtable_print(SymbolTable *table, const Interner *names) {
     printf("\n--- Sembol Tablosu İçeriği (%d Sembol) ---\n", table->count);
     for (int i = 0; i < table->count; i++) {
         const Symbol *sym = &table->entries[i];
         printf("[%03d] %-15s | Tipi: %-10s", 
                i, 
-               sym->name, 
+               interner_name(names, sym->name), 
                sym->type == SYM_TYPE_LABEL ? "LABEL" : "REGISTER");
         
         if (sym->type == SYM_TYPE_LABEL) {
-            printf("| Adresi: 0x%llX (Satır %lld)", sym->details.address, sym->details.address);
+            printf("| Adresi: 0x%llX", sym->details.address);
         }
         printf("\n");
     }
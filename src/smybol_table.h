@@ -3,7 +3,8 @@
 
 #include <stddef.h>
 #include <stdbool.h>
-#include "utils.h" // MAX_LABEL_LENGTH için
+#include <stdint.h>
+#include "interner.h" // SymbolId için
 
 // Bessambly Sembol Tipleri
 typedef enum {
@@ -15,7 +16,7 @@ typedef enum {
 
 // Sembol Yapısı
 typedef struct {
-    char name[MAX_LABEL_LENGTH]; // Sembolün Adı (örn: "LOOP_START", "SUM")
+    SymbolId name;               // Sembolün isim kimliği (örn: "LOOP_START", "SUM")
     SymbolType type;             // Sembolün Tipi
     
     // Değerler
@@ -28,13 +29,15 @@ typedef struct {
     } details;
 } Symbol;
 
-// Sembol Tablosu Yapısı (Basit bir dizi tabanlı tablo kullanıyoruz)
-// Gerçek derleyiciler Hash Table kullanır, ancak başlangıç için dizi yeterlidir.
-#define MAX_SYMBOLS 1024
-
+// Sembol Tablosu Yapısı (Açık adresli özet tablosu, dinamik büyüme)
+// Semboller eklenme sırasıyla entries dizisinde tutulur; slots dizisi isim kimliğinden
+// entries indeksine O(1) erişim sağlar. Tablonun bir üst sınırı yoktur.
 typedef struct {
-    Symbol entries[MAX_SYMBOLS];
-    int count; // Tablodaki mevcut sembol sayısı
+    Symbol *entries;     // Semboller (eklenme sırasıyla)
+    int count;           // Tablodaki mevcut sembol sayısı
+    int capacity;        // entries dizisinin kapasitesi
+    int32_t *slots;      // Özet yuvaları: entries indeksi + 1 (0: boş yuva)
+    uint32_t slot_mask;  // Yuva sayısı - 1 (yuva sayısı 2'nin kuvvetidir)
 } SymbolTable;
 
 /**
@@ -46,20 +49,30 @@ SymbolTable *symtable_init();
 /**
  * @brief Tabloya yeni bir sembol ekler.
  * @param table: Sembol Tablosu işaretçisi.
- * @param name: Sembolün adı.
+ * @param name: Sembolün isim kimliği.
  * @param type: Sembolün tipi (Etiket veya Kayıt).
  * @param address: Sembolün adresi (Etiketler için zorunlu).
- * @return true eğer ekleme başarılıysa, false tablo doluysa veya sembol zaten varsa.
+ * @return true eğer ekleme başarılıysa, false sembol zaten varsa.
  */
-bool symtable_add(SymbolTable *table, const char *name, SymbolType type, long long address);
+bool symtable_add(SymbolTable *table, SymbolId name, SymbolType type, long long address);
 
 /**
  * @brief Tabloda isimle bir sembol arar.
  * @param table: Sembol Tablosu işaretçisi.
- * @param name: Aranacak sembolün adı.
+ * @param name: Aranacak sembolün isim kimliği.
  * @return const Symbol*: Sembol bulunursa işaretçisi, bulunamazsa NULL.
  */
-const Symbol *symtable_lookup(SymbolTable *table, const char *name);
+const Symbol *symtable_lookup(SymbolTable *table, SymbolId name);
+
+/**
+ * @brief Tablodaki bir sembolün adresini günceller (yerleşim geçişi etiketlerin kesin
+ * bayt adreslerini bu işlevle yazar).
+ * @param table: Sembol Tablosu işaretçisi.
+ * @param name: Sembolün isim kimliği.
+ * @param address: Yeni adres.
+ * @return true eğer sembol bulunduysa.
+ */
+bool symtable_set_address(SymbolTable *table, SymbolId name, long long address);
 
 /**
  * @brief Sembol Tablosu için ayrılan belleği serbest bırakır.
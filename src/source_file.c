@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>     // read, close
+#include <fcntl.h>      // open, O_RDONLY
+#include <sys/mman.h>   // mmap, munmap, madvise
+#include <sys/stat.h>   // fstat, S_ISREG
+
+#include "source_file.h"
+#include "utils.h" // safe_malloc/safe_realloc için
+
+#define STREAM_CHUNK_SIZE (64 * 1024) // Akış okuyucunun tek seferde okuduğu bayt sayısı
+
+// Boş dosyalar için kullanılan sabit içerik (mmap sıfır uzunlukta çalışmaz)
+static const char empty_source[1] = { '\0' };
+
+// --- Yardımcı İşlevler ---
+
+/**
+ * @brief Dosya tanımlayıcısını sonuna kadar parça parça okur (pipe ve stdin için).
+ * Arabellek gerektiğinde iki katına büyütülür, böylece toplam kopyalama doğrusal kalır.
+ * @return true eğer okuma başarılıysa.
+ */
+static bool source_file_stream(SourceFile *file, int fd) {
+    size_t capacity = STREAM_CHUNK_SIZE;
+    size_t length = 0;
+    char *buffer = (char *)safe_malloc(capacity);
+
+    while (1) {
+        if (capacity - length < STREAM_CHUNK_SIZE) {
+            capacity *= 2;
+            buffer = (char *)safe_realloc(buffer, capacity);
+        }
+
+        ssize_t bytes_read = read(fd, buffer + length, capacity - length);
+        if (bytes_read < 0) {
+            if (errno == EINTR) continue;
+            free(buffer);
+            return false;
+        }
+        if (bytes_read == 0) break; // Dosya Sonu
+
+        length += (size_t)bytes_read;
+    }
+
+    file->data = buffer;
+    file->length = length;
+    file->is_mapped = false;
+    return true;
+}
+
+/**
+ * @brief Normal bir dosyayı salt okunur olarak belleğe eşler.
+ * @return true eğer eşleme başarılıysa; false ise çağıran akış okuyucuya geri düşer.
+ */
+static bool source_file_map(SourceFile *file, int fd, size_t length) {
+    void *mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    // Lexer dosyayı baştan sona bir kez okur; çekirdeğe önceden okuma (read-ahead) ipucu ver.
+    madvise(mapping, length, MADV_SEQUENTIAL);
+
+    file->data = (const char *)mapping;
+    file->length = length;
+    file->is_mapped = true;
+    return true;
+}
+
+// --- Genel İşlev Uygulamaları ---
+
+SourceFile *source_file_open(const char *filename) {
+    bool is_stdin = strcmp(filename, "-") == 0;
+    int fd = is_stdin ? STDIN_FILENO : open(filename, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "HATA: Giriş dosyası açılamadı: %s\n", filename);
+        return NULL;
+    }
+
+    SourceFile *file = (SourceFile *)safe_malloc(sizeof(SourceFile));
+    bool success = false;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        if (st.st_size == 0) {
+            file->data = empty_source;
+            file->length = 0;
+            file->is_mapped = false;
+            success = true;
+        } else {
+            success = source_file_map(file, fd, (size_t)st.st_size);
+        }
+    }
+
+    // Eşlenemeyen girişler (pipe, stdin, karakter aygıtı) için akış okuyucu
+    if (!success) {
+        success = source_file_stream(file, fd);
+    }
+
+    if (!is_stdin) {
+        close(fd); // mmap eşlemesi dosya kapatıldıktan sonra da geçerli kalır
+    }
+
+    if (!success) {
+        fprintf(stderr, "HATA: Dosya okuma hatası: %s\n", filename);
+        free(file);
+        return NULL;
+    }
+    return file;
+}
+
+void source_file_close(SourceFile *file) {
+    if (file == NULL) return;
+
+    if (file->is_mapped) {
+        munmap((void *)file->data, file->length);
+    } else if (file->data != empty_source) {
+        free((void *)file->data);
+    }
+    free(file);
+}
@@ -0,0 +1,32 @@
+#ifndef BESSAMBLY_SOURCE_FILE_H
+#define BESSAMBLY_SOURCE_FILE_H
+
+#include <stddef.h>  // size_t için
+#include <stdbool.h> // bool için
+
+// Kaynak Dosya Yapısı
+// Normal dosyalar salt okunur olarak belleğe eşlenir (mmap), kopyalanmaz.
+// Borular (pipe) ve stdin ise parça parça okunarak bir arabellekte toplanır.
+// İki durumda da içerik NULL ile sonlandırılmış DEĞİLDİR; uzunluk açıkça verilir.
+typedef struct {
+    const char *data; // Kaynak kodun baytları
+    size_t length;    // Kaynak kodun uzunluğu (bayt)
+    bool is_mapped;   // true: mmap ile eşlendi, false: yığında (heap) tutuluyor
+} SourceFile;
+
+/**
+ * @brief Kaynak dosyayı açar ve içeriğini erişilebilir hale getirir.
+ * Normal dosyalar için mmap kullanılır; mmap kullanılamıyorsa (pipe, stdin, özel dosya)
+ * parça parça okuyan akış (streaming) okuyucuya geri düşülür.
+ * @param filename: Okunacak dosya yolu ("-" standart girişi belirtir).
+ * @return SourceFile*: Açılan kaynak dosya, hata durumunda NULL.
+ */
+SourceFile *source_file_open(const char *filename);
+
+/**
+ * @brief Kaynak dosya eşlemesini kaldırır veya arabelleği serbest bırakır.
+ * @param file: Kapatılacak kaynak dosya.
+ */
+void source_file_close(SourceFile *file);
+
+#endif // BESSAMBLY_SOURCE_FILE_H
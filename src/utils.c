@@ -1,6 +1,5 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <ctype.h> // isspace, isalnum vb. için
 #include "utils.h"
 #include "error.h" // Hata raporlama için
 
@@ -26,20 +25,62 @@ void *safe_realloc(void *ptr, size_t size) {
 }
 
 
+// --- Karakter Sınıfı Tablosu ---
+// Tablo derleme zamanında belirlenmiş başlatıcılarla (designated initializers) oluşturulur.
+// "C" yerel ayarındaki isspace/isalpha/isalnum ile aynı sınıflandırmayı verir.
+
+#define CC_LETTER (CHAR_CLASS_IDENT_START | CHAR_CLASS_IDENT)
+#define CC_HEX_LETTER (CC_LETTER | CHAR_CLASS_HEX_DIGIT)
+#define CC_DIGIT (CHAR_CLASS_IDENT | CHAR_CLASS_DIGIT | CHAR_CLASS_HEX_DIGIT)
+
+const uint8_t char_class_table[256] = {
+    [' '] = CHAR_CLASS_BLANK, ['\t'] = CHAR_CLASS_BLANK, ['\v'] = CHAR_CLASS_BLANK,
+    ['\f'] = CHAR_CLASS_BLANK, ['\r'] = CHAR_CLASS_BLANK,
+    ['\n'] = CHAR_CLASS_NEWLINE,
+
+    ['0'] = CC_DIGIT, ['1'] = CC_DIGIT, ['2'] = CC_DIGIT, ['3'] = CC_DIGIT, ['4'] = CC_DIGIT,
+    ['5'] = CC_DIGIT, ['6'] = CC_DIGIT, ['7'] = CC_DIGIT, ['8'] = CC_DIGIT, ['9'] = CC_DIGIT,
+
+    ['A'] = CC_HEX_LETTER, ['B'] = CC_HEX_LETTER, ['C'] = CC_HEX_LETTER, ['D'] = CC_HEX_LETTER,
+    ['E'] = CC_HEX_LETTER, ['F'] = CC_HEX_LETTER, ['G'] = CC_LETTER, ['H'] = CC_LETTER,
+    ['I'] = CC_LETTER, ['J'] = CC_LETTER, ['K'] = CC_LETTER, ['L'] = CC_LETTER,
+    ['M'] = CC_LETTER, ['N'] = CC_LETTER, ['O'] = CC_LETTER, ['P'] = CC_LETTER,
+    ['Q'] = CC_LETTER, ['R'] = CC_LETTER, ['S'] = CC_LETTER, ['T'] = CC_LETTER,
+    ['U'] = CC_LETTER, ['V'] = CC_LETTER, ['W'] = CC_LETTER, ['X'] = CC_LETTER,
+    ['Y'] = CC_LETTER, ['Z'] = CC_LETTER,
+
+    ['a'] = CC_HEX_LETTER, ['b'] = CC_HEX_LETTER, ['c'] = CC_HEX_LETTER, ['d'] = CC_HEX_LETTER,
+    ['e'] = CC_HEX_LETTER, ['f'] = CC_HEX_LETTER, ['g'] = CC_LETTER, ['h'] = CC_LETTER,
+    ['i'] = CC_LETTER, ['j'] = CC_LETTER, ['k'] = CC_LETTER, ['l'] = CC_LETTER,
+    ['m'] = CC_LETTER, ['n'] = CC_LETTER, ['o'] = CC_LETTER, ['p'] = CC_LETTER,
+    ['q'] = CC_LETTER, ['r'] = CC_LETTER, ['s'] = CC_LETTER, ['t'] = CC_LETTER,
+    ['u'] = CC_LETTER, ['v'] = CC_LETTER, ['w'] = CC_LETTER, ['x'] = CC_LETTER,
+    ['y'] = CC_LETTER, ['z'] = CC_LETTER,
+
+    ['_'] = CC_LETTER,
+
+    ['+'] = CHAR_CLASS_OPERATOR, ['-'] = CHAR_CLASS_OPERATOR, ['*'] = CHAR_CLASS_OPERATOR,
+    ['/'] = CHAR_CLASS_OPERATOR, ['&'] = CHAR_CLASS_OPERATOR, ['|'] = CHAR_CLASS_OPERATOR,
+    ['<'] = CHAR_CLASS_OPERATOR, ['>'] = CHAR_CLASS_OPERATOR, ['='] = CHAR_CLASS_OPERATOR,
+    ['!'] = CHAR_CLASS_OPERATOR, [':'] = CHAR_CLASS_OPERATOR, ['['] = CHAR_CLASS_OPERATOR,
+    [']'] = CHAR_CLASS_OPERATOR,
+};
+
+
 // Dize (String) İşlevleri
 
 bool is_whitespace(char c) {
-    // isspace() fonksiyonu, boşluk, sekme, yeni satır vb. kontrol eder.
-    return (bool)isspace((unsigned char)c);
+    // Boşluk, sekme, yeni satır vb. (isspace ile aynı küme)
+    return CHAR_HAS_CLASS(c, CHAR_CLASS_BLANK | CHAR_CLASS_NEWLINE);
 }
 
 bool is_valid_start_char(char c) {
     // Bessambly'de tanımlayıcılar (etiketler/kayıtlar) harfle veya '_' ile başlamalıdır.
     // Bessambly'nin basit yapısı gereği tek harfli kayıtlar (A, B, C...) de bu kurala uyar.
-    return (bool)isalpha((unsigned char)c) || c == '_';
+    return CHAR_HAS_CLASS(c, CHAR_CLASS_IDENT_START);
 }
 
 bool is_valid_char(char c) {
     // Bessambly'de tanımlayıcılar harf, rakam veya '_' içerebilir.
-    return (bool)isalnum((unsigned char)c) || c == '_';
+    return CHAR_HAS_CLASS(c, CHAR_CLASS_IDENT);
 }
\ No newline at end of file
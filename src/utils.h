@@ -3,10 +3,10 @@
 
 #include <stddef.h> // size_t için
 #include <stdbool.h> // bool için
+#include <stdint.h> // uint8_t için
 
 // Sabitler
 #define MAX_LINE_LENGTH 256 // Bessambly kaynak kodunda maksimum satır uzunluğu
-#define MAX_LABEL_LENGTH 32 // Etiketler için maksimum isim uzunluğu
 
 // Genel Bellek Yönetimi İşlevleri (Hata Kontrollü)
 
@@ -26,6 +26,22 @@ void *safe_malloc(size_t size);
 void *safe_realloc(void *ptr, size_t size);
 
 
+// Karakter Sınıfları (Lexer ve yardımcı işlevler için, derleme zamanında oluşturulan tablo)
+// Bir karakter birden fazla sınıfa ait olabilir; sınıflar bit bayrağı olarak tutulur.
+#define CHAR_CLASS_BLANK       0x01 // '\n' hariç boşluk: ' ', '\t', '\v', '\f', '\r'
+#define CHAR_CLASS_NEWLINE     0x02 // '\n'
+#define CHAR_CLASS_IDENT_START 0x04 // Tanımlayıcı başlangıcı: harf veya '_'
+#define CHAR_CLASS_IDENT       0x08 // Tanımlayıcı devamı: harf, rakam veya '_'
+#define CHAR_CLASS_DIGIT       0x10 // Ondalık rakam
+#define CHAR_CLASS_HEX_DIGIT   0x20 // Onaltılık rakam
+#define CHAR_CLASS_OPERATOR    0x40 // Operatör veya ayırıcı başlangıcı
+
+extern const uint8_t char_class_table[256];
+
+// Karakterin verilen sınıf(lar)dan birine ait olup olmadığını kontrol eder
+#define CHAR_HAS_CLASS(c, cls) ((char_class_table[(unsigned char)(c)] & (cls)) != 0)
+
+
 // Dize (String) İşlevleri
 
 /**